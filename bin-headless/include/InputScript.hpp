@@ -0,0 +1,33 @@
+#pragma once
+
+#include "game/engine/GameRulesEngine.hpp"
+#include <filesystem>
+#include <vector>
+
+/// <summary>
+/// Scripted player input for headless runs.
+///
+/// Each non-empty line of a script file has the form `<tick> <action>`
+/// where action is one of `none`, `red` or `blue`. The action is held
+/// from the given tick until the next entry. Lines starting with `#`
+/// are comments.
+/// </summary>
+class [[nodiscard]] InputScript final
+{
+    struct [[nodiscard]] Entry final
+    {
+        unsigned tick = 0;
+        GameInput input;
+    };
+
+public:
+    InputScript() = default;
+
+    static InputScript loadFromFile(const std::filesystem::path& path);
+
+public:
+    [[nodiscard]] GameInput getInputAt(unsigned tick) const;
+
+private:
+    std::vector<Entry> entries;
+};
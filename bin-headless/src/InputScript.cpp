@@ -0,0 +1,50 @@
+#include "InputScript.hpp"
+#include "misc/Compatibility.hpp"
+#include <fstream>
+#include <sstream>
+
+static GameInput parseAction(const std::string& action)
+{
+    if (action == "none") return GameInput {};
+    if (action == "red") return GameInput { .magnetizeRed = true };
+    if (action == "blue") return GameInput { .magnetizeBlue = true };
+
+    throw std::runtime_error(uni::format("Unknown action '{}'", action));
+}
+
+InputScript InputScript::loadFromFile(const std::filesystem::path& path)
+{
+    auto&& file = std::ifstream(path);
+    if (!file)
+        throw std::runtime_error(
+            uni::format("Could not open input script {}", path.string()));
+
+    auto&& script = InputScript();
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line.starts_with('#')) continue;
+
+        auto&& stream = std::istringstream(line);
+        unsigned tick = 0;
+        std::string action;
+        if (!(stream >> tick >> action))
+            throw std::runtime_error(
+                uni::format("Malformed input script line '{}'", line));
+
+        script.entries.push_back(Entry {
+            .tick = tick,
+            .input = parseAction(action),
+        });
+    }
+
+    std::ranges::stable_sort(script.entries, {}, &Entry::tick);
+    return script;
+}
+
+GameInput InputScript::getInputAt(unsigned tick) const
+{
+    auto&& itr = std::ranges::upper_bound(entries, tick, {}, &Entry::tick);
+    if (itr == entries.begin()) return GameInput {};
+    return std::prev(itr)->input;
+}
@@ -0,0 +1,359 @@
+#include "InputScript.hpp"
+#include "filesystem/AssetArchive.hpp"
+#include "filesystem/LevelPack.hpp"
+#include "filesystem/TiledLoader.hpp"
+#include "game/SceneBuilder.hpp"
+#include "game/SimulationConstants.hpp"
+#include "game/engine/GameRulesEngine.hpp"
+#include "misc/Compatibility.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cxxopts.hpp>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <thread>
+
+enum class [[nodiscard]] LevelOutcome
+{
+    Won,
+    Died,
+    TimedOut,
+    // The level could not be loaded or simulated
+    Failed,
+};
+
+struct [[nodiscard]] SimulationResult final
+{
+    std::string levelName;
+    LevelOutcome outcome = LevelOutcome::TimedOut;
+    unsigned ticks = 0;
+    double wallSeconds = 0.0;
+    std::string error;
+};
+
+static std::string toString(LevelOutcome outcome)
+{
+    switch (outcome)
+    {
+    case LevelOutcome::Won:
+        return "won";
+    case LevelOutcome::Died:
+        return "died";
+    case LevelOutcome::Failed:
+        return "failed";
+    default:
+        return "timeout";
+    }
+}
+
+static SimulationResult simulateLevel(
+    const std::filesystem::path& path,
+    const InputScript& script,
+    const InputSettings& settings,
+    const unsigned maxTicks)
+{
+    const auto level =
+        SceneBuilder::convertToTiledLevel(TiledLoader::loadLevel(path));
+    auto&& scene = SceneBuilder::buildScene(level);
+    auto&& gameEvents = EventQueue<GameEvent>();
+    auto&& audioEvents = AudioEventQueue();
+    auto&& engine =
+        GameRulesEngine(gameEvents, audioEvents, scene, settings);
+
+    auto&& result = SimulationResult {
+        .levelName = path.filename().string(),
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+
+    engine.update(0.f, GameInput { .start = true });
+    for (; result.ticks < maxTicks; ++result.ticks)
+    {
+        // Exactly one tick per update, nothing is left in the accumulator
+        engine.update(SIMULATION_TIMESTEP, script.getInputAt(result.ticks));
+        gameEvents.processEvents([](auto) {});
+        audioEvents.processEvents([](auto) {});
+
+        if (scene.contactListener->won)
+        {
+            result.outcome = LevelOutcome::Won;
+            ++result.ticks;
+            break;
+        }
+        else if (scene.contactListener->died)
+        {
+            result.outcome = LevelOutcome::Died;
+            ++result.ticks;
+            break;
+        }
+    }
+
+    result.wallSeconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+    return result;
+}
+
+static void printColliderStats(const std::vector<std::filesystem::path>& levels)
+{
+    const auto modes = std::array {
+        std::pair { ColliderMode::RowRuns, "row runs" },
+        std::pair { ColliderMode::MergedRectangles, "rectangles" },
+        std::pair { ColliderMode::ChainOutline, "chains" },
+    };
+
+    std::cout << uni::format(
+        "{:<16} {:<12} {:>8} {:>8}\n",
+        "level",
+        "colliders",
+        "bodies",
+        "fixtures");
+    for (auto&& path : levels)
+    {
+        const auto level =
+            SceneBuilder::convertToTiledLevel(TiledLoader::loadLevel(path));
+        for (auto&& [mode, modeName] : modes)
+        {
+            auto&& world = Box2D::createWorld();
+            SceneBuilder::generateColliders(world, level, mode);
+            const auto stats = Box2D::getStats(world);
+            std::cout << uni::format(
+                "{:<16} {:<12} {:>8} {:>8}\n",
+                path.filename().string(),
+                modeName,
+                stats.bodyCount,
+                stats.fixtureCount);
+        }
+    }
+}
+
+static void writeLevelPack(
+    const std::vector<std::filesystem::path>& levels,
+    const std::filesystem::path& outputPath)
+{
+    auto&& tiledLevels = std::vector<std::pair<std::string, TiledLevel>>();
+    for (auto&& path : levels)
+    {
+        tiledLevels.emplace_back(
+            path.filename().string(),
+            SceneBuilder::convertToTiledLevel(TiledLoader::loadLevel(path)));
+    }
+
+    const auto bytes = LevelPack::compile(tiledLevels);
+
+    auto&& file = std::ofstream(outputPath, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    if (!file)
+        throw std::runtime_error(
+            uni::format("Could not write {}", outputPath.string()));
+
+    std::cout << uni::format(
+        "Packed {} levels into {} ({} bytes)\n",
+        levels.size(),
+        outputPath.string(),
+        bytes.size());
+}
+
+static void writeAssetArchive(
+    const std::filesystem::path& assetDir,
+    const std::optional<std::filesystem::path>& levelPackPath,
+    const std::filesystem::path& outputPath)
+{
+    auto&& extraFiles = std::map<std::string, std::filesystem::path>();
+    if (levelPackPath) extraFiles["levels.pack"] = *levelPackPath;
+    const auto bytes = AssetArchive::compile(assetDir, extraFiles);
+
+    auto&& file = std::ofstream(outputPath, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    if (!file)
+        throw std::runtime_error(
+            uni::format("Could not write {}", outputPath.string()));
+
+    std::cout << uni::format(
+        "Archived {} into {} ({} bytes)\n",
+        assetDir.string(),
+        outputPath.string(),
+        bytes.size());
+}
+
+static std::vector<std::filesystem::path>
+collectLevels(const std::filesystem::path& levelsDir)
+{
+    auto&& levels = std::vector<std::filesystem::path>();
+    for (auto&& entry : std::filesystem::directory_iterator(levelsDir))
+    {
+        if (entry.path().extension() == ".json")
+            levels.push_back(entry.path());
+    }
+
+    std::ranges::sort(levels);
+    return levels;
+}
+
+static std::vector<SimulationResult> simulateLevels(
+    const std::vector<std::filesystem::path>& levels,
+    const InputScript& script,
+    const InputSettings& settings,
+    const unsigned maxTicks,
+    const unsigned jobCount)
+{
+    auto&& results = std::vector<SimulationResult>(levels.size());
+    auto&& nextLevelIdx = std::atomic<size_t>(0);
+
+    auto&& worker = [&]
+    {
+        for (size_t idx = nextLevelIdx++; idx < levels.size();
+             idx = nextLevelIdx++)
+        {
+            // An exception escaping a thread would terminate the process,
+            // so a broken level is reported alongside the others instead
+            try
+            {
+                results[idx] =
+                    simulateLevel(levels[idx], script, settings, maxTicks);
+            }
+            catch (const std::exception& ex)
+            {
+                results[idx] = SimulationResult {
+                    .levelName = levels[idx].filename().string(),
+                    .outcome = LevelOutcome::Failed,
+                    .error = ex.what(),
+                };
+            }
+        }
+    };
+
+    {
+        auto&& threads = std::vector<std::jthread>();
+        for (unsigned i = 0; i < jobCount; ++i)
+            threads.emplace_back(worker);
+    }
+
+    return results;
+}
+
+int main(int argc, char* argv[])
+{
+    auto&& options = cxxopts::Options(
+        "level-simulator",
+        "Simulates levels without rendering, driven by scripted input");
+
+    // clang-format off
+    options.add_options()
+        ("l,levels", "Directory with level files",
+            cxxopts::value<std::string>()->default_value("assets/levels"))
+        ("level", "Simulate only given level file(s)",
+            cxxopts::value<std::vector<std::string>>())
+        ("s,script", "Input script file",
+            cxxopts::value<std::string>())
+        ("t,ticks", "Maximum number of simulated ticks per level",
+            cxxopts::value<unsigned>()->default_value("36000"))
+        ("j,jobs", "Number of levels simulated in parallel",
+            cxxopts::value<unsigned>()->default_value(
+                std::to_string(std::max(1u, std::thread::hardware_concurrency()))))
+        ("same-color-attracts", "Invert magnet polarity behaviour")
+        ("require-win", "Exit with error unless every level is won")
+        ("collider-stats", "Only print collider counts of each collider mode")
+        ("write-pack", "Only compile the levels into given level pack file",
+            cxxopts::value<std::string>())
+        ("assets", "Asset directory packed by write-archive",
+            cxxopts::value<std::string>()->default_value("assets"))
+        ("write-archive", "Only pack the asset directory into given archive file",
+            cxxopts::value<std::string>())
+        ("archive-level-pack", "Level pack stored in the archive by write-archive",
+            cxxopts::value<std::string>())
+        ("h,help", "Print usage");
+    // clang-format on
+
+    try
+    {
+        const auto args = options.parse(argc, argv);
+        if (args.count("help"))
+        {
+            std::cout << options.help() << std::endl;
+            return 0;
+        }
+        else if (args.count("write-archive"))
+        {
+            writeAssetArchive(
+                args["assets"].as<std::string>(),
+                args.count("archive-level-pack")
+                    ? std::optional<std::filesystem::path>(
+                          args["archive-level-pack"].as<std::string>())
+                    : std::nullopt,
+                args["write-archive"].as<std::string>());
+            return 0;
+        }
+
+        const auto levels =
+            args.count("level")
+                ? args["level"].as<std::vector<std::string>>()
+                      | std::views::transform(
+                          [](const std::string& str)
+                          { return std::filesystem::path(str); })
+                      | uniranges::to<std::vector>()
+                : collectLevels(args["levels"].as<std::string>());
+        if (args.count("collider-stats"))
+        {
+            printColliderStats(levels);
+            return 0;
+        }
+        else if (args.count("write-pack"))
+        {
+            writeLevelPack(levels, args["write-pack"].as<std::string>());
+            return 0;
+        }
+
+        const auto script =
+            args.count("script")
+                ? InputScript::loadFromFile(args["script"].as<std::string>())
+                : InputScript();
+        const auto settings = InputSettings {
+            .sameColorAttracts = args.count("same-color-attracts") > 0,
+        };
+
+        const auto results = simulateLevels(
+            levels,
+            script,
+            settings,
+            args["ticks"].as<unsigned>(),
+            std::max(1u, args["jobs"].as<unsigned>()));
+
+        bool allWon = true;
+        bool anyFailed = false;
+        std::cout << uni::format(
+            "{:<16} {:<8} {:>8} {:>10} {:>12}\n",
+            "level",
+            "outcome",
+            "ticks",
+            "time[s]",
+            "ticks/s");
+        for (auto&& result : results)
+        {
+            allWon &= result.outcome == LevelOutcome::Won;
+            if (result.outcome == LevelOutcome::Failed)
+            {
+                anyFailed = true;
+                std::cerr << uni::format(
+                    "{}: {}\n", result.levelName, result.error);
+            }
+            std::cout << uni::format(
+                "{:<16} {:<8} {:>8} {:>10.2f} {:>12.0f}\n",
+                result.levelName,
+                toString(result.outcome),
+                result.ticks,
+                result.ticks * SIMULATION_TIMESTEP,
+                result.ticks / std::max(result.wallSeconds, 1e-9));
+        }
+
+        return anyFailed || (args.count("require-win") && !allWon) ? 1 : 0;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+}
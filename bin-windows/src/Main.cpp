@@ -5,6 +5,7 @@
 #include <filesystem/AppStorage.hpp>
 #include <misc/CMakeVars.hpp>
 #include <misc/DependencyContainer.hpp>
+#include <misc/Tracer.hpp>
 
 int main(int, char*[])
 {
@@ -27,6 +28,9 @@ int main(int, char*[])
         app.run();
 
         AppStorage::saveFile(SETTINGS_FILE_NAME, settings);
+        AppStorage::saveFile(TRACE_FILE_NAME, Tracer::exportChromeTrace());
+        AppStorage::saveFile(
+            FRAME_PROFILE_FILE_NAME, dependencies.profiler.exportCsv());
     }
     catch (const std::exception& ex)
     {
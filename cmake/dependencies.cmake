@@ -19,14 +19,25 @@ if ( "${CMAKE_SYSTEM_NAME}" STREQUAL "Android" )
 endif()
 
 set ( SFML_STATIC_LIBRARIES ${USE_SFML_TGUI_STATIC_LINKAGE} )
+
+if ( BUILD_HEADLESS_ONLY )
+    # The simulation core only needs sf::Vector2 and sf::FileInputStream
+    set ( SFML_BUILD_WINDOW OFF )
+    set ( SFML_BUILD_GRAPHICS OFF )
+    set ( SFML_BUILD_AUDIO OFF )
+    set ( SFML_BUILD_NETWORK OFF )
+endif ()
+
 CPMAddPackage("gh:SFML/SFML#${SFML_VERSION}")
 
-set ( TGUI_BACKEND SFML_GRAPHICS )
-set ( TGUI_STATIC_LIBRARIES ${USE_SFML_TGUI_STATIC_LINKAGE} )
-CPMAddPackage("gh:texus/TGUI#${TGUI_VERSION}")
+if ( NOT BUILD_HEADLESS_ONLY )
+    set ( TGUI_BACKEND SFML_GRAPHICS )
+    set ( TGUI_STATIC_LIBRARIES ${USE_SFML_TGUI_STATIC_LINKAGE} )
+    CPMAddPackage("gh:texus/TGUI#${TGUI_VERSION}")
 
-CPMAddPackage("gh:nerudaj/dgm-lib#${DGM_LIB_VERSION}")
-AddCatch( "${CATCH2_VERSION}" )
+    CPMAddPackage("gh:nerudaj/dgm-lib#${DGM_LIB_VERSION}")
+    AddCatch( "${CATCH2_VERSION}" )
+endif ()
 
 if ( "${CMAKE_SYSTEM_NAME}" STREQUAL "Android" )
     CPMAddPackage("gh:fmtlib/fmt#${FMTLIB_VERSION}")
@@ -0,0 +1,42 @@
+# Builds the asset archive with a headless build for the host and stages it
+# together with the loose assets into the directory Gradle packs into the APK.
+#
+# Usage: cmake -D SOURCE_DIR=<dir> -D HOST_BUILD_DIR=<dir>
+#              -D DESTINATION_DIR=<dir> -P stage-android-assets.cmake
+
+include ( "${CMAKE_CURRENT_LIST_DIR}/vars.cmake" )
+
+execute_process (
+    COMMAND ${CMAKE_COMMAND}
+        -S "${SOURCE_DIR}"
+        -B "${HOST_BUILD_DIR}"
+        -D BUILD_HEADLESS_ONLY=ON
+        -D CMAKE_BUILD_TYPE=Release
+    COMMAND_ERROR_IS_FATAL ANY
+)
+
+execute_process (
+    COMMAND ${CMAKE_COMMAND}
+        --build "${HOST_BUILD_DIR}"
+        --config Release
+        --target asset-archive
+    COMMAND_ERROR_IS_FATAL ANY
+)
+
+file ( REMOVE_RECURSE "${DESTINATION_DIR}" )
+
+file (
+    COPY
+        "${SOURCE_DIR}/assets/"
+    DESTINATION
+        "${DESTINATION_DIR}"
+    FILES_MATCHING
+        ${LOOSE_ASSET_PATTERNS}
+)
+
+file (
+    COPY
+        "${HOST_BUILD_DIR}/assets.archive"
+    DESTINATION
+        "${DESTINATION_DIR}"
+)
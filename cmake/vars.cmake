@@ -1,5 +1,7 @@
 set ( THE_PROJECT_NAME "MagRider" )
+set ( CORE_TARGET_NAME "game-core" )
 set ( LIB_TARGET_NAME "game-lib" )
+set ( SIMULATOR_TARGET_NAME "level-simulator" )
 set ( TEST_TARGET_NAME "unit-tests" )
 
 string ( TOLOWER "${THE_PROJECT_NAME}" PROJECT_NAME_LOWERCASE )
@@ -18,3 +20,14 @@ set ( ANDROID_NDK_VERSION "26.1.10909125" )
 set ( ANDROID_MIN_SDK "22" )
 set ( ANDROID_TARGET_SDK "33" )
 set ( ANDROID_ENFORCED_ORIENTATION "landscape" ) # landscape | portrait
+
+# Assets
+# Files that ship next to the asset archive, everything else is read from it.
+# Keep in sync with the files AssetArchive::compile leaves out.
+set ( LOOSE_ASSET_PATTERNS
+    PATTERN "*.clip"
+    PATTERN "*.anim"
+    PATTERN "*.txt"
+    REGEX "/ui-themes/[^/]+$"
+    PATTERN "levels" EXCLUDE
+)
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "filesystem/MappedFile.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+/// <summary>
+/// Whole asset tree stored in a single file, so every asset is a view
+/// into one mapping instead of a separately opened and copied file.
+///
+/// Layout: header, index with one entry per file sorted by path, paths
+/// of the files, then contents of the files aligned to 16 bytes.
+/// </summary>
+class [[nodiscard]] AssetArchive final
+{
+public:
+    static constexpr std::uint32_t VERSION = 1;
+
+    /// <summary>
+    /// Archive without any files, every lookup falls back to the filesystem
+    /// </summary>
+    AssetArchive() = default;
+
+    /// <summary>
+    /// Validates the index, throws if it is truncated or of a different
+    /// version. Paths passed to find are resolved relative to mountPoint.
+    /// </summary>
+    AssetArchive(MappedFile&& file, const std::filesystem::path& mountPoint);
+
+    AssetArchive(
+        std::vector<std::byte>&& buffer,
+        const std::filesystem::path& mountPoint);
+
+    AssetArchive(AssetArchive&&) = default;
+    AssetArchive(const AssetArchive&) = delete;
+
+public:
+    /// <summary>
+    /// Packs the files under rootDir that can be loaded from memory.
+    /// Level sources, themes, clips, animations and licenses are left out.
+    /// Extra files are stored under the archived path they are keyed by,
+    /// replacing a file of the same path under rootDir.
+    /// </summary>
+    static std::vector<std::byte> compile(
+        const std::filesystem::path& rootDir,
+        const std::map<std::string, std::filesystem::path>& extraFiles = {});
+
+    /// <summary>
+    /// View into the archive, valid for the whole lifetime of the archive
+    /// </summary>
+    [[nodiscard]] std::optional<std::span<const std::byte>>
+    find(const std::filesystem::path& path) const;
+
+    [[nodiscard]] std::vector<std::string> getFilePaths() const;
+
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return entries.empty();
+    }
+
+private:
+    struct [[nodiscard]] Entry final
+    {
+        std::string_view path;
+        std::span<const std::byte> data;
+    };
+
+    void validate();
+
+private:
+    // Heap buffer and mapping don't move with the archive,
+    // so the views stay valid when the archive is moved
+    std::variant<std::monostate, MappedFile, std::vector<std::byte>> storage;
+    std::span<const std::byte> bytes;
+    std::filesystem::path mountPoint;
+    std::vector<Entry> entries;
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+// Records are copied byte by byte, binary assets are little-endian
+static_assert(std::endian::native == std::endian::little);
+
+/// <summary>
+/// Helpers for reading and writing fixed-size records of binary asset
+/// formats (level pack, asset archive)
+/// </summary>
+class [[nodiscard]] BinaryRecords final
+{
+public:
+    /// <summary>
+    /// Copies the record out of the bytes, so it doesn't need to be aligned
+    /// </summary>
+    template<class T>
+    static T read(std::span<const std::byte> bytes, std::size_t offset)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        if (!isInBounds(bytes, offset, sizeof(T)))
+            throw std::runtime_error("Unexpected end of binary data");
+
+        auto&& record = T {};
+        std::memcpy(&record, bytes.data() + offset, sizeof(T));
+        return record;
+    }
+
+    template<class T>
+    static void append(std::vector<std::byte>& bytes, const T& record)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        auto&& begin = reinterpret_cast<const std::byte*>(&record);
+        bytes.insert(bytes.end(), begin, begin + sizeof(T));
+    }
+
+    [[nodiscard]] static bool isInBounds(
+        std::span<const std::byte> bytes,
+        std::size_t offset,
+        std::size_t size) noexcept
+    {
+        return offset <= bytes.size() && size <= bytes.size() - offset;
+    }
+
+    [[nodiscard]] static std::uint32_t toOffset(std::size_t value)
+    {
+        if (value > std::numeric_limits<std::uint32_t>::max())
+            throw std::runtime_error("Binary data exceeds 4 GB");
+        return static_cast<std::uint32_t>(value);
+    }
+
+    /// <summary>
+    /// FNV-1a
+    /// </summary>
+    [[nodiscard]] static std::uint64_t
+    computeHash(std::span<const std::byte> bytes) noexcept
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (auto&& byte : bytes)
+        {
+            hash ^= static_cast<std::uint64_t>(byte);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+};
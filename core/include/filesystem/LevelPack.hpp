@@ -0,0 +1,92 @@
+#pragma once
+
+#include "filesystem/MappedFile.hpp"
+#include "game/TiledLevel.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+/// <summary>
+/// All levels compiled into a single binary blob, so the game doesn't
+/// have to parse Tiled JSON files at startup.
+///
+/// Layout: header, index with one entry per level sorted by name, then
+/// for every level one byte per tile, object records and texts of the
+/// objects. The header holds a hash of everything after it.
+/// </summary>
+class [[nodiscard]] LevelPack final
+{
+public:
+    static constexpr std::uint32_t VERSION = 1;
+
+    /// <summary>
+    /// Validates the pack, throws if it is truncated, corrupted
+    /// or of a different version
+    /// </summary>
+    explicit LevelPack(MappedFile&& file);
+
+    explicit LevelPack(std::vector<std::byte>&& buffer);
+
+    /// <summary>
+    /// Non-owning, the bytes must outlive the pack
+    /// </summary>
+    explicit LevelPack(std::span<const std::byte> view);
+
+    LevelPack(LevelPack&&) = default;
+    LevelPack(const LevelPack&) = delete;
+
+public:
+    /// <summary>
+    /// Serializes levels into the pack format. Each level must have
+    /// exactly one tile layer and one object layer.
+    /// </summary>
+    static std::vector<std::byte>
+    compile(const std::vector<std::pair<std::string, TiledLevel>>& levels);
+
+    [[nodiscard]] std::vector<std::string> getLevelIds() const;
+
+    [[nodiscard]] bool contains(const std::string& levelId) const;
+
+    /// <summary>
+    /// View into the pack, one byte per tile
+    /// </summary>
+    [[nodiscard]] std::span<const std::uint8_t>
+    getTiles(const std::string& levelId) const;
+
+    [[nodiscard]] TiledLevel getLevel(const std::string& levelId) const;
+
+    [[nodiscard]] std::uint64_t getContentHash() const noexcept
+    {
+        return contentHash;
+    }
+
+private:
+    struct [[nodiscard]] Entry final
+    {
+        std::string name;
+        unsigned width = 0;
+        unsigned height = 0;
+        unsigned tileWidth = 0;
+        unsigned tileHeight = 0;
+        unsigned tileLayerId = 0;
+        std::size_t tilesOffset = 0;
+        std::size_t objectsOffset = 0;
+        std::size_t objectCount = 0;
+    };
+
+    void validate();
+
+    [[nodiscard]] const Entry& getEntry(const std::string& levelId) const;
+
+private:
+    // Heap buffer and mapping don't move with the pack,
+    // so the view stays valid when the pack is moved
+    std::variant<std::monostate, MappedFile, std::vector<std::byte>> storage;
+    std::span<const std::byte> bytes;
+    std::uint64_t contentHash = 0;
+    std::vector<Entry> entries;
+};
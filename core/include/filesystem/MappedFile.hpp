@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+
+/// <summary>
+/// Read-only view of a whole file mapped into memory. On Android the file
+/// is read from the APK through the asset manager instead.
+/// </summary>
+class [[nodiscard]] MappedFile final
+{
+public:
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    ~MappedFile();
+
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+public:
+    /// <summary>
+    /// Returns nullopt if the file doesn't exist or can't be opened,
+    /// throws if it exists but can't be mapped
+    /// </summary>
+    static std::optional<MappedFile> open(const std::filesystem::path& path);
+
+    [[nodiscard]] std::span<const std::byte> getBytes() const noexcept
+    {
+        return { data, size };
+    }
+
+private:
+    MappedFile(const std::byte* data, std::size_t size, void* handle) noexcept
+        : data(data), size(size), handle(handle)
+    {
+    }
+
+    void release() noexcept;
+
+private:
+    const std::byte* data = nullptr;
+    std::size_t size = 0;
+    // AAsset on Android, unused elsewhere
+    void* handle = nullptr;
+};
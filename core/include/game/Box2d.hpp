@@ -1,9 +1,10 @@
 #pragma once
 
-#include <DGM/dgm.hpp>
 #include <array>
 #include <box2d/box2d.h>
 #include <memory>
+#include <optional>
+#include <vector>
 
 using PhysicsWorld = std::unique_ptr<b2World>;
 using PhysicsBody = b2Body&;
@@ -21,6 +22,12 @@ struct SensorProperties
     unsigned value = 0;
 };
 
+struct [[nodiscard]] PhysicsWorldStats final
+{
+    unsigned bodyCount = 0;
+    unsigned fixtureCount = 0;
+};
+
 class Box2D
 {
 public:
@@ -38,43 +45,17 @@ public:
     static PhysicsBody
     createStaticTriangle(PhysicsWorld& world, std::array<b2Vec2, 3> vertices);
 
+    /// <summary>
+    /// Single static body with a chain loop fixture for each outline
+    /// </summary>
+    static PhysicsBody createStaticChains(
+        PhysicsWorld& world, const std::vector<std::vector<b2Vec2>>& loops);
+
     static PhysicsBody createDynamicBall(
         PhysicsWorld& world,
         b2Vec2 position,
         float radius,
         const DynamicBodyProperties& properties = {});
-};
-
-class [[nodiscard]] BoxDebugRenderer final : public b2Draw
-{
-public:
-    BoxDebugRenderer(dgm::Window& window) noexcept : window(window) {}
-
-    void DrawPolygon(
-        const b2Vec2* vertices,
-        int32 vertexCount,
-        const b2Color& color) override;
-
-    void DrawSolidPolygon(
-        const b2Vec2* vertices,
-        int32 vertexCount,
-        const b2Color& color) override;
-
-    void DrawCircle(
-        const b2Vec2& center, float radius, const b2Color& color) override;
-
-    void DrawSolidCircle(
-        const b2Vec2& center,
-        float radius,
-        const b2Vec2& axis,
-        const b2Color& color) override;
-
-    void DrawSegment(const b2Vec2&, const b2Vec2&, const b2Color&) override {};
-
-    void DrawTransform(const b2Transform&) override {};
-
-    void DrawPoint(const b2Vec2&, float, const b2Color&) override {};
 
-private:
-    dgm::Window& window;
+    static PhysicsWorldStats getStats(const PhysicsWorld& world);
 };
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+
+/// <summary>
+/// Contiguous run of magnets in structure-of-arrays layout
+/// </summary>
+struct [[nodiscard]] MagnetSpan final
+{
+    const float* xs = nullptr;
+    const float* ys = nullptr;
+    const int* polarities = nullptr;
+    size_t count = 0;
+};
+
+class [[nodiscard]] MagnetForces final
+{
+public:
+    /// <summary>
+    /// Sum of forces that magnets closer than MAGNET_RANGE exert on
+    /// a body at position. Magnets of the same polarity push the body
+    /// away, others pull it in.
+    ///
+    /// Processes four magnets at once with SSE2 or NEON when available,
+    /// using a single reciprocal square root per magnet.
+    /// </summary>
+    static sf::Vector2f accumulate(
+        const MagnetSpan& magnets, const sf::Vector2f& position, int polarity);
+
+    /// <summary>
+    /// Reference implementation of accumulate without any SIMD
+    /// </summary>
+    static sf::Vector2f accumulateScalar(
+        const MagnetSpan& magnets, const sf::Vector2f& position, int polarity);
+};
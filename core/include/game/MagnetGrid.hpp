@@ -0,0 +1,116 @@
+#pragma once
+
+#include "game/MagnetForces.hpp"
+#include "game/SimulationConstants.hpp"
+#include <SFML/System/Vector2.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+struct [[nodiscard]] Magnet final
+{
+    sf::Vector2f position;
+    int polarity = 0;
+};
+
+/// <summary>
+/// Uniform grid of magnets with cells of MAGNET_RANGE size.
+///
+/// Any magnet closer than MAGNET_RANGE to a point lies within the 3x3
+/// block of cells around that point, so queries only visit those cells
+/// no matter how many magnets the level has. Magnets are stored sorted
+/// by cell, so each row of the 3x3 block is a single contiguous run.
+/// Coordinates and polarities live in separate arrays so the runs can
+/// be fed directly to vectorized force kernels.
+/// </summary>
+class [[nodiscard]] MagnetGrid final
+{
+public:
+    MagnetGrid() = default;
+
+    MagnetGrid(
+        const std::vector<Magnet>& unsortedMagnets,
+        unsigned levelWidth,
+        unsigned levelHeight);
+
+public:
+    /// <summary>
+    /// Invokes callback with a MagnetSpan for each contiguous run of
+    /// magnets in cells neighbouring position. Callers still need to
+    /// test the exact distance.
+    /// </summary>
+    template<class Callback>
+    void forEachRunNear(const sf::Vector2f& position, Callback&& callback) const
+    {
+        const int cellX = toCell(position.x);
+        const int cellY = toCell(position.y);
+        const int fromX = std::max(cellX - 1, 0);
+        const int toX = std::min(cellX + 1, columnCount - 1);
+        if (fromX > toX) return;
+
+        const int fromY = std::max(cellY - 1, 0);
+        const int toY = std::min(cellY + 1, rowCount - 1);
+        for (int y = fromY; y <= toY; ++y)
+        {
+            const auto rowOffset = static_cast<size_t>(y * columnCount);
+            const auto begin = cellStarts[rowOffset + fromX];
+            const auto end = cellStarts[rowOffset + toX + 1];
+            if (begin == end) continue;
+
+            callback(MagnetSpan {
+                .xs = xs.data() + begin,
+                .ys = ys.data() + begin,
+                .polarities = polarities.data() + begin,
+                .count = end - begin,
+            });
+        }
+    }
+
+    /// <summary>
+    /// Invokes callback for every magnet in cells neighbouring position.
+    /// Callers still need to test the exact distance.
+    /// </summary>
+    template<class Callback>
+    void forEachNear(const sf::Vector2f& position, Callback&& callback) const
+    {
+        forEachRunNear(
+            position,
+            [&](const MagnetSpan& run)
+            {
+                for (size_t i = 0; i < run.count; ++i)
+                {
+                    callback(Magnet {
+                        .position = { run.xs[i], run.ys[i] },
+                        .polarity = run.polarities[i],
+                    });
+                }
+            });
+    }
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return polarities.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return polarities.empty();
+    }
+
+private:
+    [[nodiscard]] static int toCell(float coord) noexcept
+    {
+        return static_cast<int>(std::floor(coord / CELL_SIZE));
+    }
+
+private:
+    static constexpr float CELL_SIZE = MAGNET_RANGE;
+
+    int columnCount = 0;
+    int rowCount = 0;
+    // Index of the first magnet of each cell, plus one past-the-end entry
+    std::vector<unsigned> cellStarts = { 0 };
+    std::vector<float> xs;
+    std::vector<float> ys;
+    std::vector<int> polarities;
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "game/Box2d.hpp"
+#include "game/MagnetGrid.hpp"
+#include "game/TiledLevel.hpp"
+#include <array>
+#include <optional>
+#include <vector>
+
+struct [[nodiscard]] BoxCollider final
+{
+    b2Vec2 center;
+    b2Vec2 size;
+    std::optional<SensorProperties> sensor = std::nullopt;
+};
+
+/// <summary>
+/// Static geometry of a level, not bound to any physics world
+/// </summary>
+struct [[nodiscard]] ColliderShapes final
+{
+    std::vector<BoxCollider> boxes;
+    std::vector<std::array<b2Vec2, 3>> triangles;
+    std::vector<std::vector<b2Vec2>> chainLoops;
+};
+
+/// <summary>
+/// Everything derived from a level file that stays the same between
+/// attempts. Building a scene from it only instantiates Box2D bodies.
+/// </summary>
+struct [[nodiscard]] PreparedLevel final
+{
+    TiledLevel level;
+    ColliderShapes colliders;
+    MagnetGrid magnets;
+};
@@ -1,8 +1,11 @@
 #pragma once
 
+#include "game/MagnetGrid.hpp"
 #include "strings/StringId.hpp"
-#include <DGM/dgm.hpp>
+#include <SFML/System/Vector2.hpp>
 #include <box2d/box2d.h>
+#include <memory>
+#include <vector>
 
 constexpr const uintptr_t SPIKE = 1;
 constexpr const uintptr_t FINISH = 2;
@@ -29,26 +32,44 @@ public:
     bool won = false;
 };
 
-struct [[nodiscard]] Magnet final
+struct [[nodiscard]] WorldText final
 {
     sf::Vector2f position;
-    int polarity = 0;
+    StringId textId;
 };
 
-struct [[nodiscard]] WorldText final
+/// <summary>
+/// Dynamic part of a scene. Static geometry never changes during
+/// a level, so restoring this is enough to restart it.
+/// </summary>
+struct [[nodiscard]] SceneSnapshot final
 {
-    sf::Vector2f position;
-    StringId textId;
+    b2Vec2 joePosition = b2Vec2_zero;
+    float joeAngle = 0.f;
+    b2Vec2 joeLinearVelocity = b2Vec2_zero;
+    float joeAngularVelocity = 0.f;
+    int magnetPolarity = 0;
+    bool playing = false;
+    unsigned timer = 0;
+    bool died = false;
+    bool won = false;
 };
 
 struct [[nodiscard]] Scene final
 {
     std::unique_ptr<b2World> world;
     b2Body& joe;
-    std::vector<Magnet> magnets;
+    // Joe's state before the last tick, used for render interpolation
+    b2Vec2 joePreviousPosition = b2Vec2_zero;
+    float joePreviousAngle = 0.f;
+    MagnetGrid magnets;
     std::unique_ptr<SpikeContactListener> contactListener;
     int magnetPolarity = 0; // 0 off, 1 red, 2 blue
     bool playing = false;
-    float timer = 0.f;
+    unsigned timer = 0; // in simulation ticks
+    // How far between the last two ticks the current frame is, <0, 1)
+    float interpolation = 0.f;
     std::vector<WorldText> texts;
+    // State right after the level was built, used for restarting it
+    SceneSnapshot spawnSnapshot;
 };
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "game/Box2d.hpp"
+#include "game/PreparedLevel.hpp"
+#include "game/Scene.hpp"
+#include "game/TiledLevel.hpp"
+
+namespace tiled
+{
+    struct FiniteMapModel;
+}
+
+enum class [[nodiscard]] ColliderMode
+{
+    // One box per horizontal run of blocks, one sensor per spike tile
+    RowRuns,
+    // Blocks merged into maximal rectangles, adjacent spikes merged
+    MergedRectangles,
+    // Outline of all solid tiles as chain loops of a single body,
+    // spikes merged like in MergedRectangles
+    ChainOutline,
+};
+
+class SceneBuilder
+{
+public:
+    static TiledLevel convertToTiledLevel(const tiled::FiniteMapModel& map);
+
+    static ColliderShapes getColliderShapes(
+        const TiledLevel& level,
+        ColliderMode mode = ColliderMode::ChainOutline);
+
+    static void
+    instantiateColliders(PhysicsWorld& world, const ColliderShapes& shapes);
+
+    static void generateColliders(
+        PhysicsWorld& world,
+        const TiledLevel& level,
+        ColliderMode mode = ColliderMode::ChainOutline);
+
+    /// <summary>
+    /// Vertices of a slope tile relative to its top-left corner,
+    /// nullopt for tiles that are not slopes
+    /// </summary>
+    static std::optional<std::array<b2Vec2, 3>> getSlopeVertices(Tile tile);
+
+    /// <summary>
+    /// Closed outlines of the solid part of the level, slopes included.
+    /// Edges shared by two solid tiles are left out and collinear
+    /// vertices are merged.
+    /// </summary>
+    static std::vector<std::vector<b2Vec2>>
+    getSolidOutlines(const TiledLevel& level);
+
+    static MagnetGrid getMagnets(const TiledLevel& level);
+
+    /// <summary>
+    /// Computes everything needed for building scenes of the level
+    /// </summary>
+    static PreparedLevel prepareLevel(TiledLevel level);
+
+    static Scene buildScene(const TiledLevel& level);
+
+    static Scene buildScene(const PreparedLevel& prepared);
+};
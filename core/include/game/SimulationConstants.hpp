@@ -0,0 +1,21 @@
+#pragma once
+
+constexpr const float JOE_DENSITY = 0.5f;
+constexpr const float JOE_FRICTION = 0.5f;
+constexpr const float JOE_RESTITUTION = 0.4f;
+
+constexpr const float MAGNET_RANGE = 6.f;
+constexpr const float MAGNET_FORCE = 2.9f;
+
+constexpr const int MAGNET_POLARITY_NONE = 0;
+constexpr const int MAGNET_POLARITY_RED = 1;
+constexpr const int MAGNET_POLARITY_BLUE = 2;
+
+constexpr const int VELOCITY_ITERATIONS = 6;
+constexpr const int POSITION_ITERATIONS = 4;
+
+// Physics always advance in fixed ticks, independently of the frame rate
+constexpr const unsigned SIMULATION_TICK_RATE = 120;
+constexpr const float SIMULATION_TIMESTEP = 1.f / SIMULATION_TICK_RATE;
+// Upper bound of ticks simulated in a single frame after a hitch
+constexpr const unsigned MAX_SIMULATION_STEPS_PER_FRAME = 8;
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "game/Scene.hpp"
+#include "game/events/AudioEvents.hpp"
+#include "game/events/EventQueue.hpp"
+#include "game/events/GameEvents.hpp"
+#include "settings/InputSettings.hpp"
+
+/// <summary>
+/// Player intent sampled once per frame. Decoupled from the
+/// input devices so the simulation can be driven without a window.
+/// </summary>
+struct [[nodiscard]] GameInput final
+{
+    bool start = false;
+    bool magnetizeRed = false;
+    bool magnetizeBlue = false;
+};
+
+class [[nodiscard]] GameRulesEngine final
+{
+public:
+    GameRulesEngine(
+        EventQueue<GameEvent>& gameEventQueue,
+        AudioEventQueue& audioEventQueue,
+        Scene& scene,
+        const InputSettings& inputSettings) noexcept
+        : gameEventQueue(gameEventQueue)
+        , audioEventQueue(audioEventQueue)
+        , scene(scene)
+        , inputSettings(inputSettings)
+    {
+    }
+
+    GameRulesEngine(GameRulesEngine&&) = delete;
+    GameRulesEngine(const GameRulesEngine&) = delete;
+
+public:
+    /// <summary>
+    /// Advances the simulation by as many fixed ticks as fit into
+    /// the elapsed frame time (up to MAX_SIMULATION_STEPS_PER_FRAME)
+    /// </summary>
+    void update(const float deltaTime, const GameInput& input);
+
+    [[nodiscard]] SceneSnapshot takeSnapshot() const;
+
+    /// <summary>
+    /// Puts the scene back into a previously taken snapshot in place,
+    /// without rebuilding the physics world
+    /// </summary>
+    void restoreSnapshot(const SceneSnapshot& snapshot);
+
+    /// <summary>
+    /// Time spent in Box2D steps during the last update
+    /// </summary>
+    [[nodiscard]] float getPhysicsMilliseconds() const noexcept
+    {
+        return physicsMilliseconds;
+    }
+
+private:
+    void tick();
+
+private:
+    EventQueue<GameEvent>& gameEventQueue;
+    AudioEventQueue& audioEventQueue;
+    Scene& scene;
+    const InputSettings& inputSettings;
+    float accumulator = 0.f;
+    float physicsMilliseconds = 0.f;
+};
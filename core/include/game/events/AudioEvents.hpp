@@ -0,0 +1,43 @@
+#pragma once
+
+#include "game/events/FixedEventQueue.hpp"
+#include <string>
+#include <variant>
+
+// Magnet events are pushed every tick a magnet pulls on Joe,
+// force is the magnitude of the total magnet force in that tick
+
+struct [[nodiscard]] JoeMagnetizedToRedAudioEvent final
+{
+    float force = 0.f;
+};
+
+struct [[nodiscard]] JoeMagnetizedToBlueAudioEvent final
+{
+    float force = 0.f;
+};
+
+struct [[nodiscard]] JoeWonAudioEvent final
+{
+};
+
+struct [[nodiscard]] JoeDiedAudioEvent final
+{
+};
+
+using AudioEvent = std::variant<
+    JoeMagnetizedToRedAudioEvent,
+    JoeMagnetizedToBlueAudioEvent,
+    JoeWonAudioEvent,
+    JoeDiedAudioEvent>;
+
+// Magnet events come every tick, the audio only needs the last one
+template<>
+constexpr DedupPolicy EVENT_DEDUP_POLICY<JoeMagnetizedToRedAudioEvent> =
+    DedupPolicy::KeepLatest;
+
+template<>
+constexpr DedupPolicy EVENT_DEDUP_POLICY<JoeMagnetizedToBlueAudioEvent> =
+    DedupPolicy::KeepLatest;
+
+using AudioEventQueue = FixedEventQueue<AudioEvent, 64>;
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+enum class [[nodiscard]] DedupPolicy
+{
+    // Every pushed event is processed
+    KeepAll,
+    // Events of the type pushed while one is pending are dropped
+    KeepFirst,
+    // Events of the type pushed while one is pending replace
+    // its payload, keeping its place in the queue
+    KeepLatest,
+};
+
+/// <summary>
+/// Specialize for event types that should be deduplicated
+/// </summary>
+template<class Event>
+constexpr DedupPolicy EVENT_DEDUP_POLICY = DedupPolicy::KeepAll;
+
+/// <summary>
+/// Drop-in alternative to EventQueue over a ring buffer of fixed capacity.
+/// Nothing is allocated after construction. Events pushed into a full
+/// queue are dropped and counted, events pushed while processing are
+/// processed in the same call. T must be a std::variant.
+/// </summary>
+template<class T, std::size_t Capacity>
+class [[nodiscard]] FixedEventQueue final
+{
+    static_assert(
+        Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+        "Capacity must be a power of two");
+
+public:
+    static constexpr std::size_t CAPACITY = Capacity;
+
+public:
+    template<class EventType, class... Args>
+    void pushEvent(Args&&... args)
+    {
+        constexpr auto TYPE_IDX = getTypeIndex<EventType>();
+        constexpr auto POLICY = EVENT_DEDUP_POLICY<EventType>;
+
+        if constexpr (POLICY != DedupPolicy::KeepAll)
+        {
+            if (const auto pending = pendingIdxs[TYPE_IDX]; pending != NONE)
+            {
+                if constexpr (POLICY == DedupPolicy::KeepLatest)
+                    events[pending & MASK].template emplace<TYPE_IDX>(
+                        EventType { std::forward<Args>(args)... });
+                return;
+            }
+        }
+
+        if (tail - head == Capacity)
+        {
+            ++overflowCount;
+            return;
+        }
+
+        if constexpr (POLICY != DedupPolicy::KeepAll)
+            pendingIdxs[TYPE_IDX] = tail;
+        events[tail & MASK].template emplace<TYPE_IDX>(
+            EventType { std::forward<Args>(args)... });
+        ++tail;
+    }
+
+    template<class Visitor>
+    void processEvents(Visitor&& visitor)
+    {
+        while (head != tail)
+        {
+            // The slot is released only after dispatch, so events pushed
+            // by the visitor can't overwrite the one being processed
+            auto&& event = events[head & MASK];
+            if constexpr (HAS_DEDUP)
+            {
+                if (pendingIdxs[event.index()] == head)
+                    pendingIdxs[event.index()] = NONE;
+            }
+
+            dispatch(
+                visitor,
+                event,
+                std::make_index_sequence<std::variant_size_v<T>>());
+            ++head;
+        }
+
+        // Rewinding the empty queue keeps reusing the same few slots,
+        // which stay in cache, instead of walking the whole buffer
+        head = 0;
+        tail = 0;
+    }
+
+    [[nodiscard]] std::size_t getSize() const noexcept
+    {
+        return static_cast<std::size_t>(tail - head);
+    }
+
+    /// <summary>
+    /// Number of events dropped because the queue was full
+    /// </summary>
+    [[nodiscard]] std::uint64_t getOverflowCount() const noexcept
+    {
+        return overflowCount;
+    }
+
+private:
+    template<class EventType, std::size_t Idx = 0>
+    static consteval std::size_t getTypeIndex()
+    {
+        static_assert(
+            Idx < std::variant_size_v<T>, "EventType is not in the variant");
+        if constexpr (std::is_same_v<
+                          std::variant_alternative_t<Idx, T>,
+                          EventType>)
+            return Idx;
+        else
+            return getTypeIndex<EventType, Idx + 1>();
+    }
+
+    template<std::size_t... Idxs>
+    static consteval bool hasDedup(std::index_sequence<Idxs...>)
+    {
+        return (
+            (EVENT_DEDUP_POLICY<std::variant_alternative_t<Idxs, T>>
+             != DedupPolicy::KeepAll)
+            || ...);
+    }
+
+    // Compares the index against each alternative in turn and calls
+    // the handler for the matching type. Events are never valueless,
+    // so unlike std::visit there is no check or exception path for it.
+    template<class Visitor, std::size_t... Idxs>
+    static void
+    dispatch(Visitor& visitor, T& event, std::index_sequence<Idxs...>)
+    {
+        const auto typeIdx = event.index();
+        std::ignore =
+            ((typeIdx == Idxs && (visitor(*std::get_if<Idxs>(&event)), true))
+             || ...);
+    }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+    static constexpr bool HAS_DEDUP =
+        hasDedup(std::make_index_sequence<std::variant_size_v<T>>());
+    static constexpr std::uint64_t NONE =
+        std::numeric_limits<std::uint64_t>::max();
+
+    std::array<T, Capacity> events = {};
+    // A slot is index & MASK, indices only grow until the queue is drained
+    std::uint64_t head = 0;
+    std::uint64_t tail = 0;
+    std::uint64_t overflowCount = 0;
+    // Index of the pending event of each deduplicated type
+    std::array<std::uint64_t, std::variant_size_v<T>> pendingIdxs = [] {
+        auto&& idxs = std::array<std::uint64_t, std::variant_size_v<T>>();
+        idxs.fill(NONE);
+        return idxs;
+    }();
+};
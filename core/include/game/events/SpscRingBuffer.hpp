@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+/// <summary>
+/// Bounded lock-free queue for exactly one producer thread and
+/// exactly one consumer thread. Nothing is allocated after construction,
+/// pushing into a full buffer fails instead of blocking.
+/// </summary>
+template<class T, std::size_t Capacity>
+class [[nodiscard]] SpscRingBuffer final
+{
+    static_assert(
+        Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+        "Capacity must be a power of two");
+    static_assert(std::is_default_constructible_v<T>);
+
+public:
+    static constexpr std::size_t CAPACITY = Capacity;
+
+public:
+    SpscRingBuffer() = default;
+    SpscRingBuffer(SpscRingBuffer&&) = delete;
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+
+public:
+    /// <summary>
+    /// Producer only, returns false when the buffer is full
+    /// </summary>
+    template<class U>
+    [[nodiscard]] bool tryPush(U&& item)
+    {
+        const auto tail = writeIdx.load(std::memory_order_relaxed);
+        if (tail - readIdxCache == Capacity)
+        {
+            readIdxCache = readIdx.load(std::memory_order_acquire);
+            if (tail - readIdxCache == Capacity) return false;
+        }
+
+        slots[tail & MASK] = std::forward<U>(item);
+        writeIdx.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// <summary>
+    /// Consumer only
+    /// </summary>
+    [[nodiscard]] std::optional<T> tryPop()
+    {
+        const auto head = readIdx.load(std::memory_order_relaxed);
+        if (head == writeIdxCache)
+        {
+            writeIdxCache = writeIdx.load(std::memory_order_acquire);
+            if (head == writeIdxCache) return std::nullopt;
+        }
+
+        auto&& item = std::optional<T>(std::move(slots[head & MASK]));
+        readIdx.store(head + 1, std::memory_order_release);
+        return item;
+    }
+
+    /// <summary>
+    /// Consumer only
+    /// </summary>
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return readIdx.load(std::memory_order_relaxed)
+               == writeIdx.load(std::memory_order_acquire);
+    }
+
+    /// <summary>
+    /// Consumer only, passes every available item to the callback
+    /// and returns how many there were
+    /// </summary>
+    template<class Callback>
+    std::size_t drain(Callback&& callback)
+    {
+        std::size_t count = 0;
+        while (auto&& item = tryPop())
+        {
+            callback(std::move(*item));
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+    // Keeps indices touched by different threads on different cache lines
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    // Indices only ever grow, a slot is index & MASK
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> writeIdx = 0;
+    // Producer's last seen readIdx, refreshed only when the buffer looks full
+    std::size_t readIdxCache = 0;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> readIdx = 0;
+    // Consumer's last seen writeIdx, refreshed only when it looks empty
+    std::size_t writeIdxCache = 0;
+
+    alignas(CACHE_LINE_SIZE) std::array<T, Capacity> slots = {};
+};
@@ -1,7 +1,5 @@
 #pragma once
 
-#include <DGM/classes/Compatibility.hpp>
-
 #ifdef ANDROID
 #include <fmt/core.h>
 #include <range/v3/all.hpp>
@@ -30,8 +30,10 @@ enum class [[nodiscard]] StringId
     EnableFullscreen,
     SetResolution,
     SetUiScale,
+    DynamicResolution,
     SetTheme,
     RenderColliders,
+    RenderColliderBounds,
     ShowFPS,
     SoundVolume,
     MusicVolume,
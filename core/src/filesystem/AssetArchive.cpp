@@ -0,0 +1,221 @@
+#include "filesystem/AssetArchive.hpp"
+#include "filesystem/BinaryRecords.hpp"
+#include "misc/Compatibility.hpp"
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string_view>
+
+constexpr auto ARCHIVE_MAGIC = std::array { 'M', 'R', 'A', 'A' };
+constexpr std::size_t DATA_ALIGNMENT = 16;
+
+// Types with loaders that can read from memory, everything else
+// is read through its path and ships next to the archive
+constexpr auto ARCHIVED_EXTENSIONS = std::array<std::string_view, 6> {
+    ".json", ".ogg", ".pack", ".png", ".ttf", ".wav"
+};
+
+// Tiled sources are compiled into the level pack and themes reference
+// their images by path, so neither is worth archiving
+constexpr auto LOOSE_DIRECTORIES =
+    std::array<std::string_view, 2> { "levels", "ui-themes" };
+
+struct [[nodiscard]] ArchiveHeader final
+{
+    std::array<char, 4> magic = ARCHIVE_MAGIC;
+    std::uint32_t version = AssetArchive::VERSION;
+    std::uint32_t fileCount = 0;
+    std::uint32_t byteSize = 0;
+};
+
+struct [[nodiscard]] ArchiveEntry final
+{
+    std::uint32_t pathOffset = 0;
+    std::uint32_t pathLength = 0;
+    std::uint32_t dataOffset = 0;
+    std::uint32_t dataSize = 0;
+};
+
+// No padding may end up in the file
+static_assert(sizeof(ArchiveHeader) == 16);
+static_assert(sizeof(ArchiveEntry) == 16);
+
+static bool isArchived(const std::filesystem::path& relativePath)
+{
+    auto&& contains = [](auto&& values, const std::string& value)
+    { return std::ranges::find(values, value) != values.end(); };
+
+    return !contains(LOOSE_DIRECTORIES, relativePath.begin()->string())
+           && contains(ARCHIVED_EXTENSIONS, relativePath.extension().string());
+}
+
+static std::vector<std::byte> readFile(const std::filesystem::path& path)
+{
+    auto&& file = std::ifstream(path, std::ios::binary | std::ios::ate);
+    const auto size = file.tellg();
+    if (!file.is_open() || size < 0)
+        throw std::runtime_error(
+            uni::format("Could not open {}", path.string()));
+
+    auto&& result = std::vector<std::byte>(std::size_t(size));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(result.data()), result.size());
+    if (!file)
+        throw std::runtime_error(
+            uni::format("Could not read {}", path.string()));
+    return result;
+}
+
+AssetArchive::AssetArchive(
+    MappedFile&& file, const std::filesystem::path& mountPoint)
+    : storage(std::move(file))
+    , bytes(std::get<MappedFile>(storage).getBytes())
+    , mountPoint(mountPoint)
+{
+    validate();
+}
+
+AssetArchive::AssetArchive(
+    std::vector<std::byte>&& buffer, const std::filesystem::path& mountPoint)
+    : storage(std::move(buffer))
+    , bytes(std::get<std::vector<std::byte>>(storage))
+    , mountPoint(mountPoint)
+{
+    validate();
+}
+
+std::vector<std::byte> AssetArchive::compile(
+    const std::filesystem::path& rootDir,
+    const std::map<std::string, std::filesystem::path>& extraFiles)
+{
+    // Archived path to the file it is read from, sorted by the path
+    auto&& sources = std::map<std::string, std::filesystem::path>();
+    for (auto&& entry :
+         std::filesystem::recursive_directory_iterator(rootDir))
+    {
+        auto&& relativePath = entry.path().lexically_relative(rootDir);
+        if (!entry.is_regular_file() || !isArchived(relativePath)) continue;
+        sources[relativePath.generic_string()] = entry.path();
+    }
+    for (auto&& [path, source] : extraFiles)
+        sources[path] = source;
+
+    auto&& paths = std::vector<std::string>();
+    for (auto&& [path, source] : sources)
+        paths.push_back(path);
+
+    auto&& pathsOffset =
+        sizeof(ArchiveHeader) + sizeof(ArchiveEntry) * paths.size();
+    auto&& pathsSize = std::size_t(0);
+    for (auto&& path : paths)
+        pathsSize += path.size();
+
+    auto&& alignUp = [](std::size_t value)
+    { return (value + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT; };
+
+    auto&& entries = std::vector<ArchiveEntry>();
+    auto&& data = std::vector<std::byte>();
+    const auto dataOffset = alignUp(pathsOffset + pathsSize);
+
+    for (auto&& path : paths)
+    {
+        data.resize(alignUp(data.size()));
+        auto&& content = readFile(sources.at(path));
+        entries.push_back(ArchiveEntry {
+            .pathOffset = BinaryRecords::toOffset(pathsOffset),
+            .pathLength = BinaryRecords::toOffset(path.size()),
+            .dataOffset = BinaryRecords::toOffset(dataOffset + data.size()),
+            .dataSize = BinaryRecords::toOffset(content.size()),
+        });
+        data.insert(data.end(), content.begin(), content.end());
+        pathsOffset += path.size();
+    }
+
+    auto&& result = std::vector<std::byte>();
+    result.reserve(dataOffset + data.size());
+    BinaryRecords::append(
+        result,
+        ArchiveHeader {
+            .fileCount = BinaryRecords::toOffset(entries.size()),
+            .byteSize = BinaryRecords::toOffset(dataOffset + data.size()),
+        });
+    for (auto&& entry : entries)
+        BinaryRecords::append(result, entry);
+    for (auto&& path : paths)
+    {
+        auto&& text = std::as_bytes(std::span(path));
+        result.insert(result.end(), text.begin(), text.end());
+    }
+    result.resize(dataOffset);
+    result.insert(result.end(), data.begin(), data.end());
+    return result;
+}
+
+std::optional<std::span<const std::byte>>
+AssetArchive::find(const std::filesystem::path& path) const
+{
+    if (entries.empty()) return std::nullopt;
+
+    const auto relative =
+        path.lexically_normal().lexically_relative(mountPoint).generic_string();
+    if (relative.empty() || relative.starts_with("..")) return std::nullopt;
+
+    auto&& itr = std::ranges::lower_bound(
+        entries, std::string_view(relative), {}, &Entry::path);
+    if (itr == entries.end() || itr->path != relative) return std::nullopt;
+    return itr->data;
+}
+
+std::vector<std::string> AssetArchive::getFilePaths() const
+{
+    return entries
+           | std::views::transform([](const Entry& entry)
+                                   { return std::string(entry.path); })
+           | uniranges::to<std::vector>();
+}
+
+void AssetArchive::validate()
+{
+    // Only the index is checked, hashing the whole archive would
+    // fault in every page of the mapping at startup
+    const auto header = BinaryRecords::read<ArchiveHeader>(bytes, 0);
+    if (header.magic != ARCHIVE_MAGIC)
+        throw std::runtime_error("File is not an asset archive");
+
+    if (header.version != VERSION)
+        throw std::runtime_error(uni::format(
+            "Asset archive has version {}, expected {}",
+            header.version,
+            VERSION));
+
+    if (header.byteSize != bytes.size())
+        throw std::runtime_error(uni::format(
+            "Asset archive has {} bytes, expected {}",
+            bytes.size(),
+            header.byteSize));
+
+    entries.reserve(header.fileCount);
+    for (auto&& idx : std::views::iota(0u, header.fileCount))
+    {
+        const auto record = BinaryRecords::read<ArchiveEntry>(
+            bytes, sizeof(ArchiveHeader) + idx * sizeof(ArchiveEntry));
+        if (!BinaryRecords::isInBounds(
+                bytes, record.pathOffset, record.pathLength)
+            || !BinaryRecords::isInBounds(
+                bytes, record.dataOffset, record.dataSize))
+            throw std::runtime_error(uni::format(
+                "File {} of the asset archive points outside of it", idx));
+
+        entries.push_back(Entry {
+            .path = std::string_view(
+                reinterpret_cast<const char*>(bytes.data() + record.pathOffset),
+                record.pathLength),
+            .data = bytes.subspan(record.dataOffset, record.dataSize),
+        });
+    }
+
+    if (!std::ranges::is_sorted(entries, {}, &Entry::path))
+        throw std::runtime_error("Asset archive index is not sorted");
+}
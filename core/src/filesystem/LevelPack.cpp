@@ -0,0 +1,315 @@
+#include "filesystem/LevelPack.hpp"
+#include "filesystem/BinaryRecords.hpp"
+#include "misc/Compatibility.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+constexpr auto PACK_MAGIC = std::array { 'M', 'R', 'L', 'P' };
+constexpr std::size_t MAX_LEVEL_NAME_LENGTH = 31;
+
+struct [[nodiscard]] PackHeader final
+{
+    std::array<char, 4> magic = PACK_MAGIC;
+    std::uint32_t version = LevelPack::VERSION;
+    std::uint32_t levelCount = 0;
+    std::uint32_t byteSize = 0;
+    std::uint64_t contentHash = 0;
+};
+
+struct [[nodiscard]] PackEntry final
+{
+    std::array<char, MAX_LEVEL_NAME_LENGTH + 1> name = {};
+    std::uint32_t width = 0;
+    std::uint32_t height = 0;
+    std::uint32_t tileWidth = 0;
+    std::uint32_t tileHeight = 0;
+    std::uint32_t tileLayerId = 0;
+    std::uint32_t tilesOffset = 0;
+    std::uint32_t objectsOffset = 0;
+    std::uint32_t objectCount = 0;
+};
+
+struct [[nodiscard]] PackObject final
+{
+    float x = 0.f;
+    float y = 0.f;
+    std::uint32_t kind = 0;
+    std::uint32_t textOffset = 0;
+    std::uint32_t textLength = 0;
+};
+
+// No padding may end up in the file
+static_assert(sizeof(PackHeader) == 24);
+static_assert(sizeof(PackEntry) == 64);
+static_assert(sizeof(PackObject) == 20);
+
+LevelPack::LevelPack(MappedFile&& file)
+    : storage(std::move(file))
+    , bytes(std::get<MappedFile>(storage).getBytes())
+{
+    validate();
+}
+
+LevelPack::LevelPack(std::span<const std::byte> view) : bytes(view)
+{
+    validate();
+}
+
+LevelPack::LevelPack(std::vector<std::byte>&& buffer)
+    : storage(std::move(buffer))
+    , bytes(std::get<std::vector<std::byte>>(storage))
+{
+    validate();
+}
+
+std::vector<std::byte> LevelPack::compile(
+    const std::vector<std::pair<std::string, TiledLevel>>& levels)
+{
+    auto&& sorted =
+        std::vector<const std::pair<std::string, TiledLevel>*>();
+    for (auto&& level : levels)
+        sorted.push_back(&level);
+    std::ranges::sort(
+        sorted, [](auto&& a, auto&& b) { return a->first < b->first; });
+
+    auto&& entries = std::vector<PackEntry>();
+    auto&& data = std::vector<std::byte>();
+    const auto dataOffset =
+        sizeof(PackHeader) + sizeof(PackEntry) * sorted.size();
+
+    for (auto&& ptr : sorted)
+    {
+        auto&& [name, level] = *ptr;
+        if (name.empty() || name.size() > MAX_LEVEL_NAME_LENGTH)
+            throw std::runtime_error(uni::format(
+                "Level name '{}' must have 1 to {} characters",
+                name,
+                MAX_LEVEL_NAME_LENGTH));
+
+        if (!entries.empty() && name == entries.back().name.data())
+            throw std::runtime_error(
+                uni::format("Level '{}' is in the pack twice", name));
+
+        if (level.tileLayers.size() != 1 || level.objectLayers.size() != 1)
+            throw std::runtime_error(uni::format(
+                "Level '{}' must have exactly one tile and one object layer",
+                name));
+
+        auto&& tiles = level.tileLayers.front().tiles;
+        if (tiles.size() != std::size_t(level.width) * level.height)
+            throw std::runtime_error(uni::format(
+                "Level '{}' has {} tiles, expected {}x{}",
+                name,
+                tiles.size(),
+                level.width,
+                level.height));
+
+        auto&& entry = PackEntry {
+            .width = level.width,
+            .height = level.height,
+            .tileWidth = level.tileWidth,
+            .tileHeight = level.tileHeight,
+            .tileLayerId = level.tileLayers.front().id,
+            .tilesOffset = BinaryRecords::toOffset(dataOffset + data.size()),
+        };
+        std::ranges::copy(name, entry.name.begin());
+
+        for (auto&& tile : tiles)
+        {
+            const auto value = static_cast<unsigned>(tile);
+            if (value > std::numeric_limits<std::uint8_t>::max())
+                throw std::runtime_error(uni::format(
+                    "Level '{}' has tile {} that doesn't fit a byte",
+                    name,
+                    value));
+            data.push_back(static_cast<std::byte>(value));
+        }
+
+        auto&& objects = level.objectLayers.front().objects;
+        entry.objectsOffset = BinaryRecords::toOffset(dataOffset + data.size());
+        entry.objectCount = BinaryRecords::toOffset(objects.size());
+
+        // Texts of the level follow right after its object records
+        auto&& textOffset =
+            dataOffset + data.size() + sizeof(PackObject) * objects.size();
+        for (auto&& object : objects)
+        {
+            BinaryRecords::append(
+                data,
+                PackObject {
+                    .x = object.position.x,
+                    .y = object.position.y,
+                    .kind = static_cast<std::uint32_t>(object.kind),
+                    .textOffset = BinaryRecords::toOffset(textOffset),
+                    .textLength = BinaryRecords::toOffset(object.data.size()),
+                });
+            textOffset += object.data.size();
+        }
+
+        for (auto&& object : objects)
+        {
+            auto&& text = std::as_bytes(std::span(object.data));
+            data.insert(data.end(), text.begin(), text.end());
+        }
+
+        entries.push_back(entry);
+    }
+
+    auto&& result = std::vector<std::byte>();
+    result.reserve(dataOffset + data.size());
+    BinaryRecords::append(
+        result,
+        PackHeader {
+            .levelCount = BinaryRecords::toOffset(entries.size()),
+            .byteSize = BinaryRecords::toOffset(dataOffset + data.size()),
+        });
+    for (auto&& entry : entries)
+        BinaryRecords::append(result, entry);
+    result.insert(result.end(), data.begin(), data.end());
+
+    const auto hash = BinaryRecords::computeHash(
+        std::span(result).subspan(sizeof(PackHeader)));
+    std::memcpy(
+        result.data() + offsetof(PackHeader, contentHash),
+        &hash,
+        sizeof(hash));
+    return result;
+}
+
+std::vector<std::string> LevelPack::getLevelIds() const
+{
+    return entries
+           | std::views::transform([](const Entry& entry)
+                                   { return entry.name; })
+           | uniranges::to<std::vector>();
+}
+
+bool LevelPack::contains(const std::string& levelId) const
+{
+    return std::ranges::binary_search(entries, levelId, {}, &Entry::name);
+}
+
+std::span<const std::uint8_t>
+LevelPack::getTiles(const std::string& levelId) const
+{
+    auto&& entry = getEntry(levelId);
+    return { reinterpret_cast<const std::uint8_t*>(
+                 bytes.data() + entry.tilesOffset),
+             std::size_t(entry.width) * entry.height };
+}
+
+TiledLevel LevelPack::getLevel(const std::string& levelId) const
+{
+    auto&& entry = getEntry(levelId);
+
+    auto&& objects = std::vector<ObjectData>();
+    objects.reserve(entry.objectCount);
+    for (auto&& idx : std::views::iota(std::size_t(0), entry.objectCount))
+    {
+        const auto object = BinaryRecords::read<PackObject>(
+            bytes, entry.objectsOffset + idx * sizeof(PackObject));
+        objects.push_back(ObjectData {
+            .position = sf::Vector2f(object.x, object.y),
+            .kind = static_cast<ObjectKind>(object.kind),
+            .data = std::string(
+                reinterpret_cast<const char*>(bytes.data() + object.textOffset),
+                object.textLength),
+        });
+    }
+
+    auto&& toTile = [](std::uint8_t tile) { return static_cast<Tile>(tile); };
+
+    return TiledLevel {
+        .width = entry.width,
+        .height = entry.height,
+        .tileWidth = entry.tileWidth,
+        .tileHeight = entry.tileHeight,
+        .tileLayers = { TileLayer {
+            .id = entry.tileLayerId,
+            .tiles = getTiles(levelId) | std::views::transform(toTile)
+                     | uniranges::to<std::vector>(),
+        } },
+        .objectLayers = { ObjectLayer { .objects = std::move(objects) } },
+    };
+}
+
+void LevelPack::validate()
+{
+    const auto header = BinaryRecords::read<PackHeader>(bytes, 0);
+    if (header.magic != PACK_MAGIC)
+        throw std::runtime_error("File is not a level pack");
+
+    if (header.version != VERSION)
+        throw std::runtime_error(uni::format(
+            "Level pack has version {}, expected {}", header.version, VERSION));
+
+    if (header.byteSize != bytes.size())
+        throw std::runtime_error(uni::format(
+            "Level pack has {} bytes, expected {}",
+            bytes.size(),
+            header.byteSize));
+
+    contentHash = BinaryRecords::computeHash(bytes.subspan(sizeof(PackHeader)));
+    if (contentHash != header.contentHash)
+        throw std::runtime_error("Level pack is corrupted");
+
+    entries.reserve(header.levelCount);
+    for (auto&& idx : std::views::iota(0u, header.levelCount))
+    {
+        const auto record = BinaryRecords::read<PackEntry>(
+            bytes, sizeof(PackHeader) + idx * sizeof(PackEntry));
+        auto&& entry = Entry {
+            .name = std::string(
+                record.name.data(),
+                std::ranges::find(record.name, '\0') - record.name.begin()),
+            .width = record.width,
+            .height = record.height,
+            .tileWidth = record.tileWidth,
+            .tileHeight = record.tileHeight,
+            .tileLayerId = record.tileLayerId,
+            .tilesOffset = record.tilesOffset,
+            .objectsOffset = record.objectsOffset,
+            .objectCount = record.objectCount,
+        };
+
+        if (!BinaryRecords::isInBounds(
+                bytes,
+                entry.tilesOffset,
+                std::size_t(entry.width) * entry.height)
+            || !BinaryRecords::isInBounds(
+                bytes,
+                entry.objectsOffset,
+                entry.objectCount * sizeof(PackObject)))
+            throw std::runtime_error(
+                uni::format("Level '{}' points outside the pack", entry.name));
+
+        for (auto&& objectIdx :
+             std::views::iota(std::size_t(0), entry.objectCount))
+        {
+            const auto object = BinaryRecords::read<PackObject>(
+                bytes, entry.objectsOffset + objectIdx * sizeof(PackObject));
+            if (!BinaryRecords::isInBounds(
+                    bytes, object.textOffset, object.textLength))
+                throw std::runtime_error(uni::format(
+                    "Object of level '{}' points outside the pack",
+                    entry.name));
+        }
+
+        entries.push_back(std::move(entry));
+    }
+
+    std::ranges::sort(entries, {}, &Entry::name);
+}
+
+const LevelPack::Entry& LevelPack::getEntry(const std::string& levelId) const
+{
+    auto&& itr = std::ranges::lower_bound(entries, levelId, {}, &Entry::name);
+    if (itr == entries.end() || itr->name != levelId)
+        throw std::runtime_error(
+            uni::format("Level '{}' is not in the pack", levelId));
+    return *itr;
+}
@@ -0,0 +1,172 @@
+#include "filesystem/MappedFile.hpp"
+#include "misc/Compatibility.hpp"
+#include <stdexcept>
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(ANDROID)
+#include <SFML/System/NativeActivity.hpp>
+#include <android/asset_manager.h>
+#include <android/native_activity.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data(std::exchange(other.data, nullptr))
+    , size(std::exchange(other.size, 0))
+    , handle(std::exchange(other.handle, nullptr))
+{
+}
+
+MappedFile::~MappedFile()
+{
+    release();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        release();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        handle = std::exchange(other.handle, nullptr);
+    }
+    return *this;
+}
+
+#if defined(_WIN32)
+
+std::optional<MappedFile> MappedFile::open(const std::filesystem::path& path)
+{
+    auto&& file = CreateFileW(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (file == INVALID_HANDLE_VALUE) return std::nullopt;
+
+    auto&& fileSize = LARGE_INTEGER {};
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        throw std::runtime_error(
+            uni::format("Could not get size of file {}", path.string()));
+    }
+
+    if (fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return MappedFile(nullptr, 0, nullptr);
+    }
+
+    auto&& mapping =
+        CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    // The view keeps the mapping alive, neither handle is needed anymore
+    auto&& view =
+        mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (mapping) CloseHandle(mapping);
+    CloseHandle(file);
+
+    if (!view)
+        throw std::runtime_error(
+            uni::format("Could not map file {}", path.string()));
+
+    return MappedFile(
+        static_cast<const std::byte*>(view),
+        static_cast<std::size_t>(fileSize.QuadPart),
+        nullptr);
+}
+
+void MappedFile::release() noexcept
+{
+    if (data) UnmapViewOfFile(data);
+    data = nullptr;
+    size = 0;
+}
+
+#elif defined(ANDROID)
+
+std::optional<MappedFile> MappedFile::open(const std::filesystem::path& path)
+{
+    auto&& asset = AAssetManager_open(
+        sf::getNativeActivity()->assetManager,
+        path.c_str(),
+        AASSET_MODE_BUFFER);
+    if (!asset) return std::nullopt;
+
+    // Uncompressed assets are mapped straight from the APK,
+    // compressed ones are inflated into a buffer owned by the asset
+    auto&& buffer = AAsset_getBuffer(asset);
+    if (!buffer)
+    {
+        AAsset_close(asset);
+        throw std::runtime_error(
+            uni::format("Could not map asset {}", path.string()));
+    }
+
+    return MappedFile(
+        static_cast<const std::byte*>(buffer),
+        static_cast<std::size_t>(AAsset_getLength64(asset)),
+        asset);
+}
+
+void MappedFile::release() noexcept
+{
+    if (handle) AAsset_close(static_cast<AAsset*>(handle));
+    handle = nullptr;
+    data = nullptr;
+    size = 0;
+}
+
+#else
+
+std::optional<MappedFile> MappedFile::open(const std::filesystem::path& path)
+{
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) return std::nullopt;
+
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) == -1)
+    {
+        ::close(fd);
+        throw std::runtime_error(
+            uni::format("Could not get size of file {}", path.string()));
+    }
+
+    const auto fileSize = static_cast<std::size_t>(fileStat.st_size);
+    if (fileSize == 0)
+    {
+        ::close(fd);
+        return MappedFile(nullptr, 0, nullptr);
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    auto&& view = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (view == MAP_FAILED)
+        throw std::runtime_error(
+            uni::format("Could not map file {}", path.string()));
+
+    return MappedFile(static_cast<const std::byte*>(view), fileSize, nullptr);
+}
+
+void MappedFile::release() noexcept
+{
+    if (data) munmap(const_cast<std::byte*>(data), size);
+    data = nullptr;
+    size = 0;
+}
+
+#endif
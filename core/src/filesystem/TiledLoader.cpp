@@ -0,0 +1,32 @@
+#include "filesystem/TiledLoader.hpp"
+#include "misc/Compatibility.hpp"
+#include <SFML/System/FileInputStream.hpp>
+#include <nlohmann/json.hpp>
+
+// sf::FileInputStream transparently reads from the APK on Android,
+// so the loader doesn't need anything beyond SFML's System module
+static std::string loadAllText(const std::filesystem::path& path)
+{
+    auto stream = sf::FileInputStream();
+    if (!stream.open(path))
+        throw std::runtime_error(
+            uni::format("Could not open file {}", path.string()));
+
+    const auto size = stream.getSize();
+    if (!size)
+        throw std::runtime_error(
+            uni::format("Could not get size of file {}", path.string()));
+
+    auto&& result = std::string(*size, '\0');
+    if (stream.read(result.data(), *size) != size)
+        throw std::runtime_error(
+            uni::format("Could not read file {}", path.string()));
+
+    return result;
+}
+
+tiled::FiniteMapModel TiledLoader::loadLevel(const std::filesystem::path& path)
+{
+    tiled::FiniteMapModel model = nlohmann::json::parse(loadAllText(path));
+    return model;
+}
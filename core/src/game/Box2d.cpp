@@ -0,0 +1,104 @@
+#include "game/Box2d.hpp"
+
+PhysicsWorld Box2D::createWorld()
+{
+    const auto GRAVITY = b2Vec2(0.0f, 9.8f);
+    return std::make_unique<b2World>(GRAVITY);
+}
+
+PhysicsBody
+Box2D::createBody(PhysicsWorld& world, b2Vec2 position, b2BodyType type)
+{
+    b2BodyDef bodyDef;
+    bodyDef.position.Set(position.x, position.y);
+    bodyDef.type = type;
+    return *world->CreateBody(&bodyDef);
+}
+
+PhysicsBody Box2D::createStaticBox(
+    PhysicsWorld& world,
+    b2Vec2 position,
+    b2Vec2 size,
+    std::optional<SensorProperties> sensorProperties)
+{
+    auto&& body = createBody(world, position);
+    b2PolygonShape boxShape;
+    boxShape.SetAsBox(size.x / 2.0f, size.y / 2.0f);
+    if (!sensorProperties)
+    {
+
+        body.CreateFixture(&boxShape, 0.0f);
+    }
+    else
+    {
+        b2FixtureDef fixtureDef;
+        fixtureDef.shape = &boxShape;
+        fixtureDef.isSensor = true;
+        fixtureDef.userData.pointer = sensorProperties->value;
+        body.CreateFixture(&fixtureDef);
+    }
+    return body;
+}
+
+PhysicsBody
+Box2D::createStaticTriangle(PhysicsWorld& world, std::array<b2Vec2, 3> vertices)
+{
+    auto&& body = createBody(world, b2Vec2_zero);
+
+    b2PolygonShape shape;
+    shape.Set(vertices.data(), static_cast<int32>(vertices.size()));
+    body.CreateFixture(&shape, 0.f);
+    return body;
+}
+
+PhysicsBody Box2D::createStaticChains(
+    PhysicsWorld& world, const std::vector<std::vector<b2Vec2>>& loops)
+{
+    auto&& body = createBody(world, b2Vec2_zero);
+
+    for (auto&& loop : loops)
+    {
+        b2ChainShape shape;
+        shape.CreateLoop(loop.data(), static_cast<int32>(loop.size()));
+        body.CreateFixture(&shape, 0.f);
+    }
+
+    return body;
+}
+
+PhysicsBody Box2D::createDynamicBall(
+    PhysicsWorld& world,
+    b2Vec2 position,
+    float radius,
+    const DynamicBodyProperties& properties)
+{
+    auto&& body = createBody(world, position, b2_dynamicBody);
+
+    b2CircleShape circleShape;
+    circleShape.m_radius = radius;
+
+    b2FixtureDef fixtureDef;
+    fixtureDef.shape = &circleShape;
+    fixtureDef.density = properties.density;
+    fixtureDef.friction = properties.friction;
+    fixtureDef.restitution = properties.restitution;
+
+    body.CreateFixture(&fixtureDef);
+    return body;
+}
+
+PhysicsWorldStats Box2D::getStats(const PhysicsWorld& world)
+{
+    auto&& stats = PhysicsWorldStats {
+        .bodyCount = static_cast<unsigned>(world->GetBodyCount()),
+    };
+
+    for (auto body = world->GetBodyList(); body; body = body->GetNext())
+    {
+        for (auto fixture = body->GetFixtureList(); fixture;
+             fixture = fixture->GetNext())
+            ++stats.fixtureCount;
+    }
+
+    return stats;
+}
@@ -0,0 +1,175 @@
+#include "game/MagnetForces.hpp"
+#include "game/SimulationConstants.hpp"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)                                       \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAGNET_FORCES_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define MAGNET_FORCES_NEON
+#include <arm_neon.h>
+#endif
+
+constexpr const float MAGNET_RANGE_SQUARED = MAGNET_RANGE * MAGNET_RANGE;
+
+static sf::Vector2f accumulateScalarFrom(
+    const MagnetSpan& magnets,
+    size_t from,
+    const sf::Vector2f& position,
+    int polarity)
+{
+    sf::Vector2f totalForce = {};
+
+    for (size_t i = from; i < magnets.count; ++i)
+    {
+        const auto direction =
+            position - sf::Vector2f(magnets.xs[i], magnets.ys[i]);
+        const float distanceSquared = direction.lengthSquared();
+        if (distanceSquared >= MAGNET_RANGE_SQUARED || distanceSquared <= 0.f)
+            continue;
+
+        const float force = polarity == magnets.polarities[i] ? MAGNET_FORCE
+                                                              : -MAGNET_FORCE;
+        totalForce += direction * (force / std::sqrt(distanceSquared));
+    }
+
+    return totalForce;
+}
+
+sf::Vector2f MagnetForces::accumulateScalar(
+    const MagnetSpan& magnets, const sf::Vector2f& position, int polarity)
+{
+    return accumulateScalarFrom(magnets, 0, position, polarity);
+}
+
+#if defined(MAGNET_FORCES_SSE2)
+
+sf::Vector2f MagnetForces::accumulate(
+    const MagnetSpan& magnets, const sf::Vector2f& position, int polarity)
+{
+    const __m128 posX = _mm_set1_ps(position.x);
+    const __m128 posY = _mm_set1_ps(position.y);
+    const __m128 rangeSquared = _mm_set1_ps(MAGNET_RANGE_SQUARED);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 threeHalves = _mm_set1_ps(1.5f);
+    const __m128 force = _mm_set1_ps(MAGNET_FORCE);
+    const __m128 signBit = _mm_set1_ps(-0.f);
+    const __m128i bodyPolarity = _mm_set1_epi32(polarity);
+
+    __m128 sumX = zero;
+    __m128 sumY = zero;
+
+    size_t i = 0;
+    for (; i + 4 <= magnets.count; i += 4)
+    {
+        const __m128 dx = _mm_sub_ps(posX, _mm_loadu_ps(magnets.xs + i));
+        const __m128 dy = _mm_sub_ps(posY, _mm_loadu_ps(magnets.ys + i));
+        const __m128 distanceSquared =
+            _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const __m128 inRange = _mm_and_ps(
+            _mm_cmplt_ps(distanceSquared, rangeSquared),
+            _mm_cmpgt_ps(distanceSquared, zero));
+
+        // Hardware estimate refined by one Newton-Raphson step
+        __m128 invLength = _mm_rsqrt_ps(distanceSquared);
+        invLength = _mm_mul_ps(
+            invLength,
+            _mm_sub_ps(
+                threeHalves,
+                _mm_mul_ps(
+                    _mm_mul_ps(half, distanceSquared),
+                    _mm_mul_ps(invLength, invLength))));
+
+        const __m128 samePolarity = _mm_castsi128_ps(_mm_cmpeq_epi32(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(magnets.polarities + i)),
+            bodyPolarity));
+        const __m128 signedForce =
+            _mm_xor_ps(force, _mm_andnot_ps(samePolarity, signBit));
+
+        // Masking also drops the NaNs of lanes with zero distance
+        const __m128 scale =
+            _mm_and_ps(inRange, _mm_mul_ps(invLength, signedForce));
+        sumX = _mm_add_ps(sumX, _mm_mul_ps(dx, scale));
+        sumY = _mm_add_ps(sumY, _mm_mul_ps(dy, scale));
+    }
+
+    alignas(16) float lanesX[4];
+    alignas(16) float lanesY[4];
+    _mm_store_ps(lanesX, sumX);
+    _mm_store_ps(lanesY, sumY);
+
+    return sf::Vector2f(
+               lanesX[0] + lanesX[1] + lanesX[2] + lanesX[3],
+               lanesY[0] + lanesY[1] + lanesY[2] + lanesY[3])
+           + accumulateScalarFrom(magnets, i, position, polarity);
+}
+
+#elif defined(MAGNET_FORCES_NEON)
+
+sf::Vector2f MagnetForces::accumulate(
+    const MagnetSpan& magnets, const sf::Vector2f& position, int polarity)
+{
+    const float32x4_t posX = vdupq_n_f32(position.x);
+    const float32x4_t posY = vdupq_n_f32(position.y);
+    const float32x4_t rangeSquared = vdupq_n_f32(MAGNET_RANGE_SQUARED);
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t force = vdupq_n_f32(MAGNET_FORCE);
+    const float32x4_t negativeForce = vdupq_n_f32(-MAGNET_FORCE);
+    const int32x4_t bodyPolarity = vdupq_n_s32(polarity);
+
+    float32x4_t sumX = zero;
+    float32x4_t sumY = zero;
+
+    size_t i = 0;
+    for (; i + 4 <= magnets.count; i += 4)
+    {
+        const float32x4_t dx = vsubq_f32(posX, vld1q_f32(magnets.xs + i));
+        const float32x4_t dy = vsubq_f32(posY, vld1q_f32(magnets.ys + i));
+        const float32x4_t distanceSquared =
+            vmlaq_f32(vmulq_f32(dx, dx), dy, dy);
+        const uint32x4_t inRange = vandq_u32(
+            vcltq_f32(distanceSquared, rangeSquared),
+            vcgtq_f32(distanceSquared, zero));
+
+        // Hardware estimate refined by one Newton-Raphson step
+        float32x4_t invLength = vrsqrteq_f32(distanceSquared);
+        invLength = vmulq_f32(
+            invLength,
+            vrsqrtsq_f32(vmulq_f32(distanceSquared, invLength), invLength));
+
+        const uint32x4_t samePolarity =
+            vceqq_s32(vld1q_s32(magnets.polarities + i), bodyPolarity);
+        const float32x4_t signedForce =
+            vbslq_f32(samePolarity, force, negativeForce);
+
+        // Masking also drops the NaNs of lanes with zero distance
+        const float32x4_t scale = vreinterpretq_f32_u32(vandq_u32(
+            inRange,
+            vreinterpretq_u32_f32(vmulq_f32(invLength, signedForce))));
+        sumX = vmlaq_f32(sumX, dx, scale);
+        sumY = vmlaq_f32(sumY, dy, scale);
+    }
+
+    float lanesX[4];
+    float lanesY[4];
+    vst1q_f32(lanesX, sumX);
+    vst1q_f32(lanesY, sumY);
+
+    return sf::Vector2f(
+               lanesX[0] + lanesX[1] + lanesX[2] + lanesX[3],
+               lanesY[0] + lanesY[1] + lanesY[2] + lanesY[3])
+           + accumulateScalarFrom(magnets, i, position, polarity);
+}
+
+#else
+
+sf::Vector2f MagnetForces::accumulate(
+    const MagnetSpan& magnets, const sf::Vector2f& position, int polarity)
+{
+    return accumulateScalarFrom(magnets, 0, position, polarity);
+}
+
+#endif
@@ -0,0 +1,39 @@
+#include "game/MagnetGrid.hpp"
+
+MagnetGrid::MagnetGrid(
+    const std::vector<Magnet>& unsortedMagnets,
+    unsigned levelWidth,
+    unsigned levelHeight)
+    : columnCount(std::max(
+          1, static_cast<int>(std::ceil(levelWidth / CELL_SIZE))))
+    , rowCount(std::max(
+          1, static_cast<int>(std::ceil(levelHeight / CELL_SIZE))))
+    , cellStarts(static_cast<size_t>(columnCount * rowCount) + 1, 0)
+    , xs(unsortedMagnets.size())
+    , ys(unsortedMagnets.size())
+    , polarities(unsortedMagnets.size())
+{
+    auto&& getCellIdx = [&](const Magnet& magnet)
+    {
+        const int x = std::clamp(toCell(magnet.position.x), 0, columnCount - 1);
+        const int y = std::clamp(toCell(magnet.position.y), 0, rowCount - 1);
+        return static_cast<size_t>(y * columnCount + x);
+    };
+
+    // Counting sort by cell index
+    for (auto&& magnet : unsortedMagnets)
+        ++cellStarts[getCellIdx(magnet) + 1];
+
+    for (size_t i = 1; i < cellStarts.size(); ++i)
+        cellStarts[i] += cellStarts[i - 1];
+
+    auto&& insertPositions =
+        std::vector<unsigned>(cellStarts.begin(), cellStarts.end() - 1);
+    for (auto&& magnet : unsortedMagnets)
+    {
+        const auto idx = insertPositions[getCellIdx(magnet)]++;
+        xs[idx] = magnet.position.x;
+        ys[idx] = magnet.position.y;
+        polarities[idx] = magnet.polarity;
+    }
+}
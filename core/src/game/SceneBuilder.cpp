@@ -0,0 +1,725 @@
+#include "game/SceneBuilder.hpp"
+#include "filesystem/models/TiledModels.hpp"
+#include "game/SimulationConstants.hpp"
+#include "misc/Compatibility.hpp"
+#include "misc/CoordConverter.hpp"
+#include "strings/StringId.hpp"
+#include "types/SemanticTypes.hpp"
+#include <cmath>
+#include <limits>
+#include <map>
+#include <set>
+
+TiledLevel SceneBuilder::convertToTiledLevel(const tiled::FiniteMapModel& map)
+{
+    auto&& tileLayers =
+        map.layers
+        | std::views::filter(
+            [](const tiled::LayerModel& layer)
+            { return std::holds_alternative<tiled::TileLayerModel>(layer); })
+        | std::views::transform(
+            [](const tiled::LayerModel& layer)
+            { return std::get<tiled::TileLayerModel>(layer); });
+
+    auto&& objectLayers =
+        map.layers
+        | std::views::filter(
+            [](const tiled::LayerModel& layer)
+            { return std::holds_alternative<tiled::ObjectGroupModel>(layer); })
+        | std::views::transform(
+            [](const tiled::LayerModel& layer)
+            { return std::get<tiled::ObjectGroupModel>(layer); });
+
+    auto&& toTileLayer = [](const tiled::TileLayerModel& model)
+    {
+        return TileLayer {
+            .id = model.id,
+            .tiles = model.data
+                     | std::views::transform(
+                         [&](int tile) -> Tile
+                         {
+                             if (tile == 0) return Tile::Empty;
+                             return static_cast<Tile>(tile);
+                         })
+                     | uniranges::to<std::vector>(),
+        };
+    };
+
+    auto&& toObjectLayer = [](const tiled::ObjectGroupModel& model)
+    {
+        return ObjectLayer {
+            .objects =
+                model.objects
+                | std::views::transform(
+                    [](const tiled::ObjectModel& objectModel)
+                    {
+                        return ObjectData {
+                            .position =
+                                sf::Vector2f(objectModel.x, objectModel.y),
+                            .kind = objectModel.text.has_value()
+                                        ? ObjectKind::Text
+                                        : ObjectKind::Point,
+                            .data = objectModel.text
+                                        .value_or(tiled::TextObjectModel {})
+                                        .text,
+                        };
+                    })
+                | uniranges::to<std::vector>(),
+        };
+    };
+
+    return TiledLevel {
+        .width = map.width,
+        .height = map.height,
+        .tileWidth = map.tilewidth,
+        .tileHeight = map.tileheight,
+        .tileLayers = tileLayers | std::views::transform(toTileLayer)
+                      | uniranges::to<std::vector<TileLayer>>(),
+        .objectLayers = objectLayers | std::views::transform(toObjectLayer)
+                        | uniranges::to<std::vector<ObjectLayer>>(),
+    };
+}
+
+static bool isWholeBlock(Tile tile)
+{
+    return tile == Tile::Block || tile == Tile::MagNeg
+           || tile == Tile::MagPlus || tile == Tile::Block2
+           || tile == Tile::Block3 || tile == Tile::Block4
+           || tile == Tile::Block5 || tile == Tile::Block6
+           || tile == Tile::Block7;
+}
+
+static Tile getTile(const TiledLevel& level, unsigned x, unsigned y)
+{
+    return level.tileLayers[0].tiles[y * level.width + x];
+}
+
+static void addStaticBlock(
+    ColliderShapes& shapes,
+    unsigned x,
+    unsigned y,
+    unsigned width,
+    unsigned height)
+{
+    const float fx = static_cast<float>(x);
+    const float fy = static_cast<float>(y);
+    const float fw = static_cast<float>(width);
+    const float fh = static_cast<float>(height);
+    shapes.boxes.push_back(BoxCollider {
+        .center = b2Vec2(fx + fw / 2.f, fy + fh / 2.f),
+        .size = b2Vec2(fw, fh),
+    });
+}
+
+/// <summary>
+/// Each horizontal run of whole blocks becomes a single box
+/// </summary>
+static void addRowRunBlocks(ColliderShapes& shapes, const TiledLevel& level)
+{
+    for (unsigned y = 0; y < level.height; ++y)
+    {
+        unsigned runStart = 0;
+        for (unsigned x = 0; x <= level.width; ++x)
+        {
+            if (x < level.width && isWholeBlock(getTile(level, x, y)))
+                continue;
+
+            if (x > runStart)
+                addStaticBlock(shapes, runStart, y, x - runStart, 1);
+            runStart = x + 1;
+        }
+    }
+}
+
+/// <summary>
+/// Greedily covers whole blocks with maximal rectangles. Each rectangle
+/// first grows as far right as it can and then down for as long as the
+/// whole span of the next row is still free.
+/// </summary>
+static void addMergedBlocks(ColliderShapes& shapes, const TiledLevel& level)
+{
+    auto&& covered = std::vector<bool>(level.width * level.height, false);
+    auto&& isFree = [&](unsigned x, unsigned y)
+    {
+        return !covered[y * level.width + x]
+               && isWholeBlock(getTile(level, x, y));
+    };
+
+    for (unsigned y = 0; y < level.height; ++y)
+    {
+        for (unsigned x = 0; x < level.width; ++x)
+        {
+            if (!isFree(x, y)) continue;
+
+            unsigned width = 1;
+            while (x + width < level.width && isFree(x + width, y))
+                ++width;
+
+            unsigned height = 1;
+            while (y + height < level.height
+                   && std::ranges::all_of(
+                       std::views::iota(x, x + width),
+                       [&](unsigned col) { return isFree(col, y + height); }))
+                ++height;
+
+            for (unsigned row = y; row < y + height; ++row)
+                for (unsigned col = x; col < x + width; ++col)
+                    covered[row * level.width + col] = true;
+
+            addStaticBlock(shapes, x, y, width, height);
+        }
+    }
+}
+
+struct [[nodiscard]] SpikeShape final
+{
+    Tile tile;
+    // Spikes of horizontal orientation merge along rows, others along columns
+    bool horizontal;
+    // Center of a single spike sensor relative to the tile origin
+    b2Vec2 offset;
+    // Thickness of the sensor across the merge direction
+    float thickness;
+};
+
+static const std::array SPIKE_SHAPES = {
+    SpikeShape { Tile::SpikeUp, true, b2Vec2(0.5f, 0.75f), 0.5f },
+    SpikeShape { Tile::SpikeDown, true, b2Vec2(0.5f, 0.25f), 0.5f },
+    SpikeShape { Tile::SpikeLeft, false, b2Vec2(0.75f, 0.5f), 0.5f },
+    SpikeShape { Tile::SpikeRight, false, b2Vec2(0.25f, 0.5f), 0.5f },
+};
+
+static void addSpikeSensor(
+    ColliderShapes& shapes,
+    const SpikeShape& shape,
+    unsigned x,
+    unsigned y,
+    unsigned length)
+{
+    const float fx = static_cast<float>(x);
+    const float fy = static_cast<float>(y);
+    const float extent = static_cast<float>(length);
+    const auto sensor = SensorProperties {
+        .value = SPIKE,
+    };
+
+    if (shape.horizontal)
+    {
+        shapes.boxes.push_back(BoxCollider {
+            .center = b2Vec2(fx + extent / 2.f, fy + shape.offset.y),
+            .size = b2Vec2(extent, shape.thickness),
+            .sensor = sensor,
+        });
+    }
+    else
+    {
+        shapes.boxes.push_back(BoxCollider {
+            .center = b2Vec2(fx + shape.offset.x, fy + extent / 2.f),
+            .size = b2Vec2(shape.thickness, extent),
+            .sensor = sensor,
+        });
+    }
+}
+
+/// <summary>
+/// Creates spike and finish sensors. When merging, consecutive spikes
+/// facing the same way share a single sensor.
+/// </summary>
+static void addSensors(
+    ColliderShapes& shapes, const TiledLevel& level, bool mergeSpikes)
+{
+    for (auto&& shape : SPIKE_SHAPES)
+    {
+        const unsigned outerCount =
+            shape.horizontal ? level.height : level.width;
+        const unsigned innerCount =
+            shape.horizontal ? level.width : level.height;
+
+        for (unsigned outer = 0; outer < outerCount; ++outer)
+        {
+            auto&& isSpike = [&](unsigned inner)
+            {
+                return shape.horizontal
+                           ? getTile(level, inner, outer) == shape.tile
+                           : getTile(level, outer, inner) == shape.tile;
+            };
+
+            for (unsigned inner = 0; inner < innerCount; ++inner)
+            {
+                if (!isSpike(inner)) continue;
+
+                unsigned length = 1;
+                while (mergeSpikes && inner + length < innerCount
+                       && isSpike(inner + length))
+                    ++length;
+
+                if (shape.horizontal)
+                    addSpikeSensor(shapes, shape, inner, outer, length);
+                else
+                    addSpikeSensor(shapes, shape, outer, inner, length);
+                inner += length - 1;
+            }
+        }
+    }
+
+    for (unsigned y = 0; y < level.height; ++y)
+    {
+        for (unsigned x = 0; x < level.width; ++x)
+        {
+            if (getTile(level, x, y) != Tile::Finish) continue;
+
+            const float fx = static_cast<float>(x);
+            const float fy = static_cast<float>(y);
+            shapes.boxes.push_back(BoxCollider {
+                .center = b2Vec2(fx + 0.5f, fy + 0.5f),
+                .size = b2Vec2(0.4f, 0.4f),
+                .sensor =
+                    SensorProperties {
+                        .value = FINISH,
+                    },
+            });
+        }
+    }
+}
+
+std::optional<std::array<b2Vec2, 3>> SceneBuilder::getSlopeVertices(Tile tile)
+{
+    using Vertices = std::array<b2Vec2, 3>;
+
+    switch (tile)
+    {
+    case Tile::FloorUp45:
+        return Vertices {
+            b2Vec2(0.f, 1.f),
+            b2Vec2(1.f, 0.f),
+            b2Vec2(1.f, 1.f),
+        };
+    case Tile::FloorDown45:
+        return Vertices {
+            b2Vec2(0.f, 0.f),
+            b2Vec2(1.f, 1.f),
+            b2Vec2(0.f, 1.f),
+        };
+    case Tile::CeilDown45:
+        return Vertices {
+            b2Vec2(0.f, 0.f),
+            b2Vec2(1.f, 0.f),
+            b2Vec2(1.f, 1.f),
+        };
+    case Tile::CeilUp45:
+        return Vertices {
+            b2Vec2(0.f, 0.f),
+            b2Vec2(1.f, 0.f),
+            b2Vec2(0.f, 1.f),
+        };
+    // 60 degree triangles
+    case Tile::FloorUp60Small:
+        return Vertices {
+            b2Vec2(0.f, 1.f),
+            b2Vec2(2.f, 0.f),
+            b2Vec2(2.f, 1.f),
+        };
+    case Tile::FloorUp120Small:
+        return Vertices {
+            b2Vec2(0.f, 2.f),
+            b2Vec2(1.f, 0.f),
+            b2Vec2(1.f, 2.f),
+        };
+    case Tile::FloorDown60Big:
+        return Vertices {
+            b2Vec2(0.f, 0.f),
+            b2Vec2(2.f, 1.f),
+            b2Vec2(0.f, 1.f),
+        };
+    case Tile::FloorDown120Small:
+        return Vertices {
+            b2Vec2(0.f, 0.f),
+            b2Vec2(1.f, 2.f),
+            b2Vec2(0.f, 2.f),
+        };
+    case Tile::CeilDown60Small:
+        return Vertices {
+            b2Vec2(0.f, 0.f),
+            b2Vec2(2.f, 0.f),
+            b2Vec2(2.f, 1.f),
+        };
+    case Tile::CeilDown120Big:
+        return Vertices {
+            b2Vec2(0.f, 0.f),
+            b2Vec2(1.f, 0.f),
+            b2Vec2(1.f, 2.f),
+        };
+    case Tile::CeilUp60Big:
+        return Vertices {
+            b2Vec2(0.f, 0.f),
+            b2Vec2(2.f, 0.f),
+            b2Vec2(0.f, 1.f),
+        };
+    case Tile::CeilUp120Big:
+        return Vertices {
+            b2Vec2(0.f, 0.f),
+            b2Vec2(1.f, 0.f),
+            b2Vec2(0.f, 2.f),
+        };
+    default:
+        return std::nullopt;
+    }
+}
+
+static void addSlopes(ColliderShapes& shapes, const TiledLevel& level)
+{
+    for (unsigned y = 0; y < level.height; ++y)
+    {
+        for (unsigned x = 0; x < level.width; ++x)
+        {
+            auto&& vertices =
+                SceneBuilder::getSlopeVertices(getTile(level, x, y));
+            if (!vertices) continue;
+
+            const auto origin =
+                b2Vec2(static_cast<float>(x), static_cast<float>(y));
+            for (auto&& vertex : *vertices)
+                vertex += origin;
+            shapes.triangles.push_back(*vertices);
+        }
+    }
+}
+
+struct [[nodiscard]] GridPoint final
+{
+    int x = 0;
+    int y = 0;
+
+    auto operator<=>(const GridPoint&) const = default;
+};
+
+using GridEdge = std::pair<GridPoint, GridPoint>;
+
+static int cross(const GridPoint& a, const GridPoint& b)
+{
+    return a.x * b.y - a.y * b.x;
+}
+
+static GridPoint operator-(const GridPoint& a, const GridPoint& b)
+{
+    return GridPoint { a.x - b.x, a.y - b.y };
+}
+
+/// <summary>
+/// Polygons of all whole blocks and slopes, every one of them wound
+/// so that its signed area is positive
+/// </summary>
+static std::vector<std::vector<GridPoint>>
+getSolidPolygons(const TiledLevel& level)
+{
+    auto&& polygons = std::vector<std::vector<GridPoint>>();
+
+    for (unsigned y = 0; y < level.height; ++y)
+    {
+        for (unsigned x = 0; x < level.width; ++x)
+        {
+            const int ix = static_cast<int>(x);
+            const int iy = static_cast<int>(y);
+            const auto tile = getTile(level, x, y);
+
+            if (isWholeBlock(tile))
+            {
+                polygons.push_back({
+                    GridPoint { ix, iy },
+                    GridPoint { ix + 1, iy },
+                    GridPoint { ix + 1, iy + 1 },
+                    GridPoint { ix, iy + 1 },
+                });
+            }
+            else if (auto&& vertices = SceneBuilder::getSlopeVertices(tile))
+            {
+                polygons.push_back(
+                    *vertices
+                    | std::views::transform(
+                        [&](const b2Vec2& vertex)
+                        {
+                            return GridPoint {
+                                ix + static_cast<int>(vertex.x),
+                                iy + static_cast<int>(vertex.y),
+                            };
+                        })
+                    | uniranges::to<std::vector>());
+            }
+            else
+            {
+                continue;
+            }
+
+            auto&& polygon = polygons.back();
+            int doubleArea = 0;
+            for (size_t i = 0; i < polygon.size(); ++i)
+                doubleArea +=
+                    cross(polygon[i], polygon[(i + 1) % polygon.size()]);
+            if (doubleArea < 0) std::ranges::reverse(polygon);
+        }
+    }
+
+    return polygons;
+}
+
+/// <summary>
+/// Directed edges of the solid polygons that are not shared with
+/// a neighbouring polygon. Axis aligned edges are split into unit steps
+/// first, so that a long side of a slope cancels out against the blocks
+/// it touches.
+/// </summary>
+static std::multiset<GridEdge> getBoundaryEdges(const TiledLevel& level)
+{
+    auto&& edges = std::multiset<GridEdge>();
+
+    auto&& addEdge = [&edges](const GridPoint& from, const GridPoint& to)
+    {
+        if (auto itr = edges.find({ to, from }); itr != edges.end())
+            edges.erase(itr);
+        else
+            edges.insert({ from, to });
+    };
+
+    for (auto&& polygon : getSolidPolygons(level))
+    {
+        for (size_t i = 0; i < polygon.size(); ++i)
+        {
+            const auto from = polygon[i];
+            const auto to = polygon[(i + 1) % polygon.size()];
+            const auto delta = to - from;
+
+            if (delta.x != 0 && delta.y != 0)
+            {
+                addEdge(from, to);
+                continue;
+            }
+
+            const auto step = GridPoint {
+                delta.x > 0 ? 1 : (delta.x < 0 ? -1 : 0),
+                delta.y > 0 ? 1 : (delta.y < 0 ? -1 : 0),
+            };
+            for (auto point = from; point != to;)
+            {
+                const auto next =
+                    GridPoint { point.x + step.x, point.y + step.y };
+                addEdge(point, next);
+                point = next;
+            }
+        }
+    }
+
+    return edges;
+}
+
+std::vector<std::vector<b2Vec2>>
+SceneBuilder::getSolidOutlines(const TiledLevel& level)
+{
+    auto&& outgoing = std::multimap<GridPoint, GridPoint>();
+    for (auto&& [from, to] : getBoundaryEdges(level))
+        outgoing.emplace(from, to);
+
+    auto&& outlines = std::vector<std::vector<b2Vec2>>();
+
+    while (!outgoing.empty())
+    {
+        const auto first = outgoing.begin();
+        const auto start = first->first;
+        auto current = first->second;
+        auto direction = current - start;
+        outgoing.erase(first);
+
+        auto&& loop = std::vector<GridPoint> { start };
+        while (current != start)
+        {
+            loop.push_back(current);
+
+            // Where two solid regions touch by a corner, turn towards
+            // the inside so each region gets its own simple loop
+            auto [begin, end] = outgoing.equal_range(current);
+            auto best = begin;
+            float bestTurn = -std::numeric_limits<float>::infinity();
+            for (auto itr = begin; itr != end; ++itr)
+            {
+                const auto candidate = itr->second - current;
+                const float turn = std::atan2(
+                    static_cast<float>(cross(direction, candidate)),
+                    static_cast<float>(
+                        direction.x * candidate.x + direction.y * candidate.y));
+                if (turn > bestTurn)
+                {
+                    bestTurn = turn;
+                    best = itr;
+                }
+            }
+
+            const auto next = best->second;
+            direction = next - current;
+            current = next;
+            outgoing.erase(best);
+        }
+
+        // Drop vertices in the middle of straight segments
+        auto&& outline = std::vector<b2Vec2>();
+        for (size_t i = 0; i < loop.size(); ++i)
+        {
+            const auto& prev = loop[(i + loop.size() - 1) % loop.size()];
+            const auto& next = loop[(i + 1) % loop.size()];
+            if (cross(loop[i] - prev, next - loop[i]) == 0) continue;
+
+            outline.push_back(b2Vec2(
+                static_cast<float>(loop[i].x), static_cast<float>(loop[i].y)));
+        }
+
+        if (outline.size() >= 3) outlines.push_back(std::move(outline));
+    }
+
+    return outlines;
+}
+
+ColliderShapes
+SceneBuilder::getColliderShapes(const TiledLevel& level, ColliderMode mode)
+{
+    auto&& shapes = ColliderShapes {};
+
+    if (mode == ColliderMode::ChainOutline)
+    {
+        shapes.chainLoops = getSolidOutlines(level);
+    }
+    else
+    {
+        if (mode == ColliderMode::RowRuns)
+            addRowRunBlocks(shapes, level);
+        else
+            addMergedBlocks(shapes, level);
+
+        addSlopes(shapes, level);
+    }
+
+    addSensors(shapes, level, mode != ColliderMode::RowRuns);
+    return shapes;
+}
+
+void SceneBuilder::instantiateColliders(
+    PhysicsWorld& world, const ColliderShapes& shapes)
+{
+    if (!shapes.chainLoops.empty())
+        Box2D::createStaticChains(world, shapes.chainLoops);
+
+    for (auto&& box : shapes.boxes)
+        Box2D::createStaticBox(world, box.center, box.size, box.sensor);
+
+    for (auto&& triangle : shapes.triangles)
+        Box2D::createStaticTriangle(world, triangle);
+}
+
+void SceneBuilder::generateColliders(
+    PhysicsWorld& world, const TiledLevel& level, ColliderMode mode)
+{
+    instantiateColliders(world, getColliderShapes(level, mode));
+}
+
+MagnetGrid SceneBuilder::getMagnets(const TiledLevel& level)
+{
+    auto&& magnets = std::vector<Magnet>();
+
+    for (unsigned y = 0; y < level.height; ++y)
+    {
+        for (unsigned x = 0; x < level.width; ++x)
+        {
+            const unsigned idx = y * level.width + x;
+            const auto tile = level.tileLayers[0].tiles[idx];
+            const float fx = static_cast<float>(x) + 0.5f;
+            const float fy = static_cast<float>(y) + 0.5f;
+
+            if (tile == Tile::MagNeg)
+                magnets.push_back(Magnet {
+                    .position = { fx, fy },
+                    .polarity = MAGNET_POLARITY_BLUE,
+                });
+            else if (tile == Tile::MagPlus)
+                magnets.push_back(Magnet {
+                    .position = { fx, fy },
+                    .polarity = MAGNET_POLARITY_RED,
+                });
+        }
+    }
+
+    return MagnetGrid(magnets, level.width, level.height);
+}
+
+static StringId toStringId(const std::string& str)
+{
+    if (!str.starts_with("$TUTORIAL")) return StringId::MaxId;
+
+    return static_cast<StringId>(
+        std::to_underlying(StringId::Tutorial1) + std::stoi(str.substr(9)) - 1);
+}
+
+PreparedLevel SceneBuilder::prepareLevel(TiledLevel level)
+{
+    auto&& colliders = getColliderShapes(level);
+    auto&& magnets = getMagnets(level);
+
+    return PreparedLevel {
+        .level = std::move(level),
+        .colliders = std::move(colliders),
+        .magnets = std::move(magnets),
+    };
+}
+
+Scene SceneBuilder::buildScene(const TiledLevel& level)
+{
+    return buildScene(prepareLevel(level));
+}
+
+Scene SceneBuilder::buildScene(const PreparedLevel& prepared)
+{
+    const auto& level = prepared.level;
+    auto world = Box2D::createWorld();
+    instantiateColliders(world, prepared.colliders);
+
+    auto spawns =
+        level.objectLayers.front().objects
+        | std::views::filter([](const ObjectData& data)
+                             { return data.kind == ObjectKind::Point; })
+        | uniranges::to<std::vector>();
+
+    auto& joeBody = Box2D::createDynamicBall(
+        world,
+        CoordConverter::screenToWorld(spawns.front().position),
+        0.5f,
+        DynamicBodyProperties {
+            .density = JOE_DENSITY,
+            .friction = JOE_FRICTION,
+            .restitution = JOE_RESTITUTION,
+        });
+
+    auto listener = std::make_unique<SpikeContactListener>();
+    world->SetContactListener(listener.get());
+
+    return Scene {
+        .world = std::move(world),
+        .joe = joeBody,
+        .joePreviousPosition = joeBody.GetPosition(),
+        .joePreviousAngle = joeBody.GetAngle(),
+        .magnets = prepared.magnets,
+        .contactListener = std::move(listener),
+        .texts = level.objectLayers.front().objects
+                 | std::views::filter([](const ObjectData& data)
+                                      { return data.kind == ObjectKind::Text; })
+                 | std::views::transform(
+                     [](const ObjectData& data)
+                     {
+                         return WorldText {
+                             .position = data.position,
+                             .textId = toStringId(data.data),
+                         };
+                     })
+                 | uniranges::to<std::vector>(),
+        .spawnSnapshot =
+            SceneSnapshot {
+                .joePosition = joeBody.GetPosition(),
+                .joeAngle = joeBody.GetAngle(),
+            },
+    };
+}
@@ -0,0 +1,130 @@
+#include "game/engine/GameRulesEngine.hpp"
+#include "game/MagnetForces.hpp"
+#include "game/SimulationConstants.hpp"
+#include <algorithm>
+#include <limits>
+
+static sf::Vector2f aggregateMagnetForces(
+    const b2Vec2& joePos,
+    int joePolarity,
+    const MagnetGrid& magnets,
+    const InputSettings& settings)
+{
+    sf::Vector2f totalForce = {};
+    if (joePolarity == MAGNET_POLARITY_NONE) return totalForce;
+
+    if (settings.sameColorAttracts) joePolarity = 3 - joePolarity;
+
+    const auto position = sf::Vector2f(joePos.x, joePos.y);
+    magnets.forEachRunNear(
+        position,
+        [&](const MagnetSpan& run)
+        {
+            totalForce +=
+                MagnetForces::accumulate(run, position, joePolarity);
+        });
+
+    return totalForce;
+}
+
+void GameRulesEngine::update(const float deltaTime, const GameInput& input)
+{
+    physicsMilliseconds = 0.f;
+
+    if (!scene.playing)
+    {
+        scene.playing = input.start;
+        return;
+    }
+
+    if (input.magnetizeRed)
+    {
+        scene.magnetPolarity = MAGNET_POLARITY_RED;
+    }
+    else if (input.magnetizeBlue)
+    {
+        scene.magnetPolarity = MAGNET_POLARITY_BLUE;
+    }
+    else
+        scene.magnetPolarity = MAGNET_POLARITY_NONE;
+
+    accumulator += deltaTime;
+
+    unsigned steps = 0;
+    while (accumulator >= SIMULATION_TIMESTEP
+           && steps < MAX_SIMULATION_STEPS_PER_FRAME)
+    {
+        tick();
+        accumulator -= SIMULATION_TIMESTEP;
+        ++steps;
+    }
+
+    // Drop the time we could not catch up with instead of
+    // spiralling into ever longer frames
+    if (steps == MAX_SIMULATION_STEPS_PER_FRAME)
+        accumulator = std::min(accumulator, SIMULATION_TIMESTEP);
+
+    scene.interpolation = accumulator / SIMULATION_TIMESTEP;
+}
+
+void GameRulesEngine::tick()
+{
+    scene.joePreviousPosition = scene.joe.GetPosition();
+    scene.joePreviousAngle = scene.joe.GetAngle();
+
+    if (!scene.contactListener->died && !scene.contactListener->won)
+        ++scene.timer;
+
+    sf::Vector2f totalForce = aggregateMagnetForces(
+        scene.joe.GetPosition(),
+        scene.magnetPolarity,
+        scene.magnets,
+        inputSettings);
+
+    // Only trigger sounds when magnet is affecting joe
+    if (const auto force = totalForce.length(); force > 0.f)
+    {
+        if (scene.magnetPolarity == MAGNET_POLARITY_RED)
+            audioEventQueue.pushEvent<JoeMagnetizedToRedAudioEvent>(force);
+        else
+            audioEventQueue.pushEvent<JoeMagnetizedToBlueAudioEvent>(force);
+    }
+
+    scene.joe.ApplyForceToCenter(b2Vec2(totalForce.x, totalForce.y), true);
+
+    scene.world->Step(
+        SIMULATION_TIMESTEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
+    physicsMilliseconds += scene.world->GetProfile().step;
+}
+
+SceneSnapshot GameRulesEngine::takeSnapshot() const
+{
+    return SceneSnapshot {
+        .joePosition = scene.joe.GetPosition(),
+        .joeAngle = scene.joe.GetAngle(),
+        .joeLinearVelocity = scene.joe.GetLinearVelocity(),
+        .joeAngularVelocity = scene.joe.GetAngularVelocity(),
+        .magnetPolarity = scene.magnetPolarity,
+        .playing = scene.playing,
+        .timer = scene.timer,
+        .died = scene.contactListener->died,
+        .won = scene.contactListener->won,
+    };
+}
+
+void GameRulesEngine::restoreSnapshot(const SceneSnapshot& snapshot)
+{
+    scene.joe.SetTransform(snapshot.joePosition, snapshot.joeAngle);
+    scene.joe.SetLinearVelocity(snapshot.joeLinearVelocity);
+    scene.joe.SetAngularVelocity(snapshot.joeAngularVelocity);
+    scene.joe.SetAwake(true);
+    scene.joePreviousPosition = snapshot.joePosition;
+    scene.joePreviousAngle = snapshot.joeAngle;
+    scene.magnetPolarity = snapshot.magnetPolarity;
+    scene.playing = snapshot.playing;
+    scene.timer = snapshot.timer;
+    scene.interpolation = 0.f;
+    scene.contactListener->died = snapshot.died;
+    scene.contactListener->won = snapshot.won;
+    accumulator = 0.f;
+}
@@ -11,6 +11,8 @@
 #include "settings/AppSettings.hpp"
 #include <DGM/dgm.hpp>
 #include <SFML/Audio.hpp>
+#include <chrono>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -31,13 +33,23 @@ public:
     void draw() override;
 
 private:
+    void pollInput();
+
     void restoreFocusImpl(const std::string& msg) override;
 
+    /// <summary>
+    /// Restarts the level in place by restoring the spawn snapshot
+    /// </summary>
+    void restartLevel();
+
 private:
     DependencyContainer& dic;
     AppSettings& settings;
     GameConfig config;
     TouchControls touchControls;
+    std::shared_ptr<const PreparedLevel> level;
     Game game;
     bool paused = false;
+    // Unset while the game is not drawn, e.g. paused
+    std::optional<FrameProfiler::Clock::time_point> lastDrawEnd;
 };
@@ -2,7 +2,10 @@
 
 #include "misc/DependencyContainer.hpp"
 #include "settings/AppSettings.hpp"
+#include "strings/StringId.hpp"
 #include <DGM/dgm.hpp>
+#include <array>
+#include <optional>
 
 class [[nodiscard]] AppStateLevelSelect final : public dgm::AppState
 {
@@ -19,6 +22,33 @@ public:
 
     void draw() override;
 
+private:
+    static constexpr size_t COLUMN_COUNT = 5;
+    static constexpr size_t ROW_COUNT = 3;
+    static constexpr size_t LEVELS_PER_TAB = COLUMN_COUNT * ROW_COUNT;
+    static constexpr size_t TAB_COUNT = 3;
+
+    struct [[nodiscard]] LevelTab final
+    {
+        StringId name;
+        std::string backgroundName;
+        size_t startIdx = 0;
+        tgui::Grid::Ptr grid;
+    };
+
+    /// <summary>
+    /// Widgets of a level card that change with its state,
+    /// along with the state they currently show
+    /// </summary>
+    struct [[nodiscard]] LevelCard final
+    {
+        tgui::Panel::Ptr panel;
+        tgui::Label::Ptr timeLabel;
+        tgui::Panel::Ptr buttonPanel;
+        std::optional<float> bestTime;
+        bool isUnlocked = false;
+    };
+
 private:
     void restoreFocusImpl(const std::string& message = "") override;
 
@@ -26,25 +56,30 @@ private:
 
     void buildLayout();
 
-    void
-    buildLevelCards(size_t startIdx, size_t columnCount, size_t rowCount) const;
+    tgui::Grid::Ptr buildLevelCards(size_t startIdx);
 
-    void buildContentGrasslands() const;
+    tgui::Panel::Ptr buildLevelCard(size_t levelIdx);
 
-    void buildContentFactory() const;
+    /// <summary>
+    /// Reloads best times from the save and updates only the cards
+    /// whose time or lock state differ from what they show
+    /// </summary>
+    void refreshLevelCards();
 
-    void buildContentLostLevels() const;
+    void updateLevelCard(const LevelCard& card) const;
 
-    tgui::Container::Ptr buildLevelCard(
-        size_t levelIdx,
-        bool isUnlocked,
-        const std::optional<float>& bestTime) const;
+    void startLevel(size_t levelIdx);
 
 private:
     DependencyContainer&
         dic;               ///< Dependency container for managing dependencies
     AppSettings& settings; ///< Application settings for configuration
     std::vector<std::string> levelIds;
+    std::array<LevelTab, TAB_COUNT> tabs;
+    std::array<LevelCard, TAB_COUNT * LEVELS_PER_TAB> levelCards;
+    tgui::Panel::Ptr layout;
     tgui::Panel::Ptr content;
     tgui::String lastSelectedTab;
+    // Widget sizes are fixed when built, Options can change the scale
+    float builtUiScale = 0.f;
 };
@@ -0,0 +1,209 @@
+#pragma once
+
+#include "misc/Compatibility.hpp"
+#include "misc/JobSystem.hpp"
+#include <DGM/classes/ResourceManager.hpp>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+/// <summary>
+/// Resource manager that loads registered resource types on first access.
+///
+/// Resources of registered types that are marked as evictable (level
+/// backgrounds, tilesets) are released in least recently used order once
+/// their total size exceeds the budget. Types that are not registered are
+/// forwarded to the underlying dgm::ResourceManager.
+///
+/// Not thread-safe, meant to be used from the main thread only.
+/// </summary>
+class [[nodiscard]] ResourceCache final
+{
+public:
+    ResourceCache(dgm::ResourceManager&& resmgr, std::size_t budget) noexcept
+        : resmgr(std::move(resmgr)), budget(budget)
+    {
+    }
+
+    ResourceCache(ResourceCache&&) = default;
+    ResourceCache(const ResourceCache&) = delete;
+
+public:
+    /// <summary>
+    /// Resources of type T will be loaded from directory / id
+    /// on the first call to get
+    /// </summary>
+    template<class T, class Loader>
+    void registerLazyType(
+        const std::filesystem::path& directory,
+        Loader&& loader,
+        std::function<std::size_t(const T&)> getByteSize,
+        std::function<bool(const std::string&)> isEvictable)
+    {
+        registerLazyType<T>(
+            directory,
+            std::forward<Loader>(loader),
+            [](T&& resource) { return std::move(resource); },
+            std::move(getByteSize),
+            std::move(isEvictable));
+    }
+
+    /// <summary>
+    /// Loading is split into decoding, which may run on a worker thread
+    /// during preload, and finalization (e.g. GPU upload), which always
+    /// runs on the thread that requested the resource
+    /// </summary>
+    template<class T, class Decoder, class Finalizer>
+    void registerLazyType(
+        const std::filesystem::path& directory,
+        Decoder&& decoder,
+        Finalizer&& finalizer,
+        std::function<std::size_t(const T&)> getByteSize,
+        std::function<bool(const std::string&)> isEvictable)
+    {
+        using Decoded = typename std::
+            invoke_result_t<Decoder, const std::filesystem::path&>::value_type;
+
+        lazyTypes[typeid(T)] = LazyType {
+            .directory = directory,
+            .decode =
+                [decoder = std::forward<Decoder>(decoder)](
+                    const std::filesystem::path& path)
+            {
+                auto&& result = decoder(path);
+                if (!result)
+                    throw std::runtime_error(uni::format(
+                        "Could not load {}: {}",
+                        path.string(),
+                        result.error().getMessage()));
+                return std::shared_ptr<void>(
+                    std::make_shared<Decoded>(std::move(result.value())));
+            },
+            .finalize =
+                [finalizer = std::forward<Finalizer>(finalizer)](
+                    std::shared_ptr<void> decoded)
+            {
+                auto&& value = std::move(*static_cast<Decoded*>(decoded.get()));
+                return std::shared_ptr<void>(
+                    std::make_shared<T>(finalizer(std::move(value))));
+            },
+            .getByteSize =
+                [getByteSize = std::move(getByteSize)](const void* resource)
+            { return getByteSize(*static_cast<const T*>(resource)); },
+            .isEvictable = std::move(isEvictable),
+        };
+    }
+
+    /// <summary>
+    /// Decodes resources that are not loaded yet in parallel on the job
+    /// system and finalizes them on the calling thread
+    /// </summary>
+    template<class T>
+    void preload(JobSystem& jobs, const std::vector<std::string>& ids)
+    {
+        preload(jobs, lazyTypes.at(typeid(T)), ids);
+    }
+
+    template<class T>
+    [[nodiscard]] const T& get(const std::string& id) const
+    {
+        if (auto&& itr = lazyTypes.find(typeid(T)); itr != lazyTypes.end())
+            return *static_cast<const T*>(acquire(itr->second, id));
+        return resmgr.get<T>(id);
+    }
+
+    template<class T>
+    [[nodiscard]] T& getMutable(const std::string& id)
+    {
+        if (auto&& itr = lazyTypes.find(typeid(T)); itr != lazyTypes.end())
+            return *static_cast<T*>(acquire(itr->second, id));
+        return resmgr.getMutable<T>(id);
+    }
+
+    /// <summary>
+    /// Inserted resources of lazy types are never evicted
+    /// </summary>
+    template<class T>
+    std::expected<bool, dgm::Error>
+    insertResource(const std::string& id, T&& resource)
+    {
+        auto&& itr = lazyTypes.find(typeid(T));
+        if (itr == lazyTypes.end())
+            return resmgr.insertResource<T>(id, std::forward<T>(resource));
+
+        auto&& entry = itr->second.entries[id];
+        if (entry.evictable) evictableByteSize -= entry.byteSize;
+        entry = Entry {
+            .resource = std::make_shared<std::decay_t<T>>(
+                std::forward<T>(resource)),
+            .lastUse = ++useCounter,
+        };
+        return true;
+    }
+
+    /// <summary>
+    /// Only available for eagerly loaded types
+    /// </summary>
+    template<class T>
+    [[nodiscard]] auto getLoadedResourceIds() const
+    {
+        return resmgr.getLoadedResourceIds<T>();
+    }
+
+    /// <summary>
+    /// Releases least recently used evictable resources until they fit
+    /// the budget. Must only be called when no reference to an evictable
+    /// resource is held, e.g. before a level is started.
+    /// </summary>
+    void evictOverBudget();
+
+    [[nodiscard]] std::size_t getEvictableByteSize() const noexcept
+    {
+        return evictableByteSize;
+    }
+
+private:
+    struct [[nodiscard]] Entry final
+    {
+        std::shared_ptr<void> resource;
+        std::size_t byteSize = 0;
+        std::uint64_t lastUse = 0;
+        bool evictable = false;
+    };
+
+    struct [[nodiscard]] LazyType final
+    {
+        std::filesystem::path directory;
+        std::function<std::shared_ptr<void>(const std::filesystem::path&)>
+            decode;
+        std::function<std::shared_ptr<void>(std::shared_ptr<void>)> finalize;
+        std::function<std::size_t(const void*)> getByteSize;
+        std::function<bool(const std::string&)> isEvictable;
+        std::map<std::string, Entry> entries = {};
+    };
+
+    [[nodiscard]] void* acquire(LazyType& type, const std::string& id) const;
+
+    void* store(
+        LazyType& type,
+        const std::string& id,
+        std::shared_ptr<void> resource) const;
+
+    void preload(
+        JobSystem& jobs, LazyType& type, const std::vector<std::string>& ids);
+
+private:
+    dgm::ResourceManager resmgr;
+    std::size_t budget = 0;
+    // Loading on first access happens from const getters
+    mutable std::map<std::type_index, LazyType> lazyTypes;
+    mutable std::uint64_t useCounter = 0;
+    mutable std::size_t evictableByteSize = 0;
+};
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "filesystem/AssetArchive.hpp"
+#include "filesystem/LevelPack.hpp"
+#include "filesystem/ResourceCache.hpp"
+#include "misc/JobSystem.hpp"
 #include "settings/AppSettings.hpp"
 #include <DGM/dgm.hpp>
 #include <filesystem>
@@ -7,8 +11,33 @@
 class ResourceLoader final
 {
 public:
-    static dgm::ResourceManager
-    loadResources(const std::filesystem::path& assetDir);
+    /// <summary>
+    /// Maps assets.archive if it exists, otherwise returns an empty archive
+    /// and assets are read from loose files
+    /// </summary>
+    static AssetArchive openArchive(const std::filesystem::path& assetDir);
+
+    /// <summary>
+    /// Loads fonts, themes and playlists right away, graphics and sounds
+    /// are loaded on first use. Graphics needed by the first screens are
+    /// decoded in parallel on the job system. Level backgrounds and tilesets
+    /// are evicted once they take more than levelAssetBudget bytes.
+    /// </summary>
+    static ResourceCache loadResources(
+        const std::filesystem::path& assetDir,
+        const AssetArchive& archive,
+        std::size_t levelAssetBudget,
+        JobSystem& jobs);
+
+    /// <summary>
+    /// Reads levels.pack from the archive or maps it, otherwise compiles
+    /// the pack from the Tiled files in the levels folder, parsing them
+    /// in parallel
+    /// </summary>
+    static LevelPack loadLevels(
+        const std::filesystem::path& assetDir,
+        const AssetArchive& archive,
+        JobSystem& jobs);
 
     static AppSettings loadSettings(const std::filesystem::path& file);
 };
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <box2d/box2d.h>
+#include <initializer_list>
+#include <vector>
+
+/// <summary>
+/// Collects everything b2World::DebugDraw emits into one triangle list
+/// and one line list and draws each with a single draw call. Shapes
+/// outside of the visible area are skipped while collecting.
+/// Vertex storage is reused between frames.
+/// </summary>
+class [[nodiscard]] BoxDebugRenderer final : public b2Draw
+{
+public:
+    static constexpr unsigned CIRCLE_SEGMENT_COUNT = 16;
+
+public:
+    /// <summary>
+    /// Draws the world into the target, culled by the view of the target
+    /// </summary>
+    void render(b2World& world, sf::RenderTarget& target);
+
+    /// <summary>
+    /// Drops collected geometry, shapes that don't intersect
+    /// the area (in screen coordinates) won't be collected
+    /// </summary>
+    void begin(const sf::FloatRect& visibleArea);
+
+    void flush(sf::RenderTarget& target) const;
+
+    [[nodiscard]] std::size_t getTriangleVertexCount() const noexcept
+    {
+        return triangles.size();
+    }
+
+    [[nodiscard]] std::size_t getLineVertexCount() const noexcept
+    {
+        return lines.size();
+    }
+
+public:
+    void DrawPolygon(
+        const b2Vec2* vertices,
+        int32 vertexCount,
+        const b2Color& color) override;
+
+    void DrawSolidPolygon(
+        const b2Vec2* vertices,
+        int32 vertexCount,
+        const b2Color& color) override;
+
+    void DrawCircle(
+        const b2Vec2& center, float radius, const b2Color& color) override;
+
+    void DrawSolidCircle(
+        const b2Vec2& center,
+        float radius,
+        const b2Vec2& axis,
+        const b2Color& color) override;
+
+    void DrawSegment(
+        const b2Vec2& p1, const b2Vec2& p2, const b2Color& color) override;
+
+    void DrawTransform(const b2Transform&) override {};
+
+    void DrawPoint(const b2Vec2&, float, const b2Color&) override {};
+
+private:
+    [[nodiscard]] bool isVisible(const b2Vec2* vertices, int32 vertexCount)
+        const noexcept;
+
+    [[nodiscard]] bool
+    isVisible(const b2Vec2& center, float radius) const noexcept;
+
+private:
+    sf::FloatRect visibleArea;
+    std::vector<sf::Vertex> triangles;
+    std::vector<sf::Vertex> lines;
+};
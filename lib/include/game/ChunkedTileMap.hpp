@@ -0,0 +1,76 @@
+#pragma once
+
+#include <DGM/dgm.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <span>
+#include <vector>
+
+/// <summary>
+/// Tile layer split into square chunks, each uploaded once into a static
+/// vertex buffer. Only chunks intersecting the view of the render target
+/// are drawn, so the cost of a frame depends on the visible area, not
+/// on the size of the level.
+/// </summary>
+class [[nodiscard]] ChunkedTileMap final : public sf::Drawable
+{
+public:
+    static constexpr unsigned CHUNK_SIZE_IN_TILES = 16;
+
+    /// <summary>
+    /// Range of chunk coordinates, end is exclusive
+    /// </summary>
+    struct [[nodiscard]] ChunkRange final
+    {
+        sf::Vector2u begin;
+        sf::Vector2u end;
+    };
+
+public:
+    /// <summary>
+    /// Tiles are indices into the frames of the clip, tiles
+    /// that are negative or out of the clip are left empty
+    /// </summary>
+    ChunkedTileMap(
+        const sf::Texture& texture,
+        const dgm::Clip& clip,
+        sf::Vector2u tileSize,
+        std::span<const int> tiles,
+        sf::Vector2u mapSize);
+
+    ChunkedTileMap(ChunkedTileMap&&) = delete;
+    ChunkedTileMap(const ChunkedTileMap&) = delete;
+
+public:
+    [[nodiscard]] static ChunkRange getVisibleChunks(
+        const sf::FloatRect& area,
+        sf::Vector2f chunkSize,
+        sf::Vector2u chunkCount) noexcept;
+
+    [[nodiscard]] sf::Vector2u getChunkCount() const noexcept
+    {
+        return chunkCount;
+    }
+
+private:
+    struct [[nodiscard]] Chunk final
+    {
+        sf::VertexBuffer buffer;
+        // Only used when vertex buffers are not supported
+        std::vector<sf::Vertex> vertices;
+    };
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+    const sf::Texture& texture;
+    sf::Vector2f chunkSize;
+    sf::Vector2u chunkCount;
+    // Row-major, empty chunks have no vertices
+    std::vector<Chunk> chunks;
+};
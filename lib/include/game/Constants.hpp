@@ -1,10 +1,23 @@
 #pragma once
 
+#include "game/SimulationConstants.hpp"
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <cstddef>
 #include <filesystem>
 
 const sf::Vector2f INTERNAL_RESOLUTION = { 640.f, 360.f };
+
+// With dynamic resolution, the world is rendered at a multiple of the
+// internal resolution that is lowered when frames take longer than this
+const float TARGET_FRAME_TIME = 1.f / 60.f;
+const unsigned MAX_RENDER_SCALE =
+#ifdef ANDROID
+    2;
+#else
+    4;
+#endif
+
 const sf::Color COLOR_BLACK = { 0, 0, 0, 255 };
 const sf::Color COLOR_WHITE = { 255, 241, 232, 255 };
 const sf::Color COLOR_DARK_GREY = { 95, 87, 79, 255 };
@@ -19,18 +32,19 @@ const sf::Color COLOR_LIGHT_PEACH = { 255, 204, 170, 255 };
 const sf::Color COLOR_DARK_PURPLE = { 126, 37, 83, 255 };
 const sf::Color COLOR_RED = { 255, 0, 77, 255 };
 
-constexpr const float JOE_DENSITY = 0.5f;
-constexpr const float JOE_FRICTION = 0.5f;
-constexpr const float JOE_RESTITUTION = 0.4f;
-
-constexpr const float MAGNET_RANGE = 6.f;
-constexpr const float MAGNET_FORCE = 2.9f;
+// Level backgrounds and tilesets that are not in use are released
+// once they take more memory than this
+const std::size_t LEVEL_ASSET_BUDGET =
+#ifdef ANDROID
+    3 * 1024 * 1024;
+#else
+    16 * 1024 * 1024;
+#endif
 
-constexpr const int MAGNET_POLARITY_NONE = 0;
-constexpr const int MAGNET_POLARITY_RED = 1;
-constexpr const int MAGNET_POLARITY_BLUE = 2;
+const auto SETTINGS_FILE_NAME = std::filesystem::path("settings.json");
 
-constexpr const int VELOCITY_ITERATIONS = 6;
-constexpr const int POSITION_ITERATIONS = 4;
+// Startup and loading timings, open in chrome://tracing or ui.perfetto.dev
+const auto TRACE_FILE_NAME = std::filesystem::path("trace.json");
 
-const auto SETTINGS_FILE_NAME = std::filesystem::path("settings.json");
+// Per-phase times of the last frames of gameplay
+const auto FRAME_PROFILE_FILE_NAME = std::filesystem::path("frames.csv");
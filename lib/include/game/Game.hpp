@@ -1,39 +1,47 @@
 #pragma once
 
+#include "filesystem/ResourceCache.hpp"
+#include "game/PreparedLevel.hpp"
 #include "game/SceneBuilder.hpp"
-#include "game/TiledLevel.hpp"
-#include "game/engine/AudioEngine.hpp"
+#include "game/engine/AudioThread.hpp"
 #include "game/engine/GameRulesEngine.hpp"
 #include "game/engine/RenderingEngine.hpp"
 #include "game/events/EventQueue.hpp"
-#include "input/Input.hpp"
 #include "settings/AppSettings.hpp"
-#include <DGM/classes/ResourceManager.hpp>
 
 class [[nodiscard]] Game final
 {
 public:
     Game(
-        const TiledLevel& level,
-        Input& input,
+        const PreparedLevel& level,
         dgm::Window& window,
-        dgm::ResourceManager& resmgr,
+        ResourceCache& resmgr,
         const AppSettings& settings,
         const StringProvider& strings,
-        const GameConfig& config)
+        const GameConfig& config,
+        RenderCache& renderCache,
+        FrameProfiler& profiler)
         : scene(SceneBuilder::buildScene(level))
-        , gameRulesEngine(gameEvents, audioEvents, scene, input, settings.input)
+        , gameRulesEngine(gameEvents, audioEvents, scene, settings.input)
         , renderingEngine(
-              window, resmgr, settings.video, strings, scene, level, config)
-        , audioEngine(resmgr, settings.audio)
+              window,
+              resmgr,
+              settings.video,
+              strings,
+              scene,
+              level.level,
+              config,
+              renderCache,
+              profiler)
+        , audioThread(resmgr, settings.audio)
     {
     }
 
 public:
     Scene scene;
     EventQueue<GameEvent> gameEvents;
-    EventQueue<AudioEvent> audioEvents;
+    AudioEventQueue audioEvents;
     GameRulesEngine gameRulesEngine;
     RenderingEngine renderingEngine;
-    AudioEngine audioEngine;
+    AudioThread audioThread;
 };
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "filesystem/LevelPack.hpp"
+#include "game/PreparedLevel.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/// <summary>
+/// Levels read from the level pack, with colliders and magnets
+/// already computed, so starting a level only instantiates Box2D bodies.
+/// </summary>
+class [[nodiscard]] PreparedLevelCache final
+{
+public:
+    explicit PreparedLevelCache(const LevelPack& pack) noexcept : pack(pack)
+    {
+    }
+
+    PreparedLevelCache(PreparedLevelCache&&) = delete;
+    PreparedLevelCache(const PreparedLevelCache&) = delete;
+
+public:
+    /// <summary>
+    /// Prepares every level of the pack on a background
+    /// thread. Subsequent calls do nothing.
+    /// </summary>
+    void prepareAllInBackground();
+
+    /// <summary>
+    /// Returns the prepared level, preparing it on the calling thread
+    /// if the background thread didn't get to it yet
+    /// </summary>
+    [[nodiscard]] std::shared_ptr<const PreparedLevel>
+    get(const std::string& levelId);
+
+private:
+    [[nodiscard]] std::shared_ptr<const PreparedLevel>
+    find(const std::string& levelId) const;
+
+    std::shared_ptr<const PreparedLevel> insert(
+        const std::string& levelId,
+        std::shared_ptr<const PreparedLevel> level);
+
+private:
+    const LevelPack& pack;
+    mutable std::mutex mutex;
+    std::map<std::string, std::shared_ptr<const PreparedLevel>> levels;
+    // Declared last so it is stopped and joined before the rest is destroyed
+    std::jthread worker;
+};
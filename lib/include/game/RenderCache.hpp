@@ -0,0 +1,57 @@
+#pragma once
+
+#include "filesystem/ResourceCache.hpp"
+#include "game/ChunkedTileMap.hpp"
+#include "game/GameConfig.hpp"
+#include "game/TiledLevel.hpp"
+#include <DGM/dgm.hpp>
+#include <memory>
+
+/// <summary>
+/// Texture atlas with everything levels of a single tileset draw from
+/// </summary>
+struct [[nodiscard]] AtlasRenderData final
+{
+    AtlasRenderData(
+        const ResourceCache& resmgr, const std::string& tilesetName);
+
+    dgm::TextureAtlas atlas;
+    dgm::AnimationStates ballAnimationStates;
+    dgm::AnimationStates magnetLineAnimationStates;
+    dgm::Clip tileset;
+};
+
+/// <summary>
+/// Keeps GPU resources of levels alive between attempts, so restarting
+/// or re-entering a level neither rebuilds the texture atlas nor
+/// the tile map.
+///
+/// Only the atlas of the last tileset and the tile map of the last level
+/// are kept, so at most one 4 MB atlas stays resident. Requesting another
+/// tileset invalidates references returned earlier, which is safe since
+/// the cache is only queried while a level is being set up.
+/// </summary>
+class [[nodiscard]] RenderCache final
+{
+public:
+    explicit RenderCache(const ResourceCache& resmgr) noexcept
+        : resmgr(resmgr)
+    {
+    }
+
+    RenderCache(RenderCache&&) = delete;
+    RenderCache(const RenderCache&) = delete;
+
+public:
+    [[nodiscard]] AtlasRenderData& getAtlas(const std::string& tilesetName);
+
+    [[nodiscard]] ChunkedTileMap&
+    getTileMap(const GameConfig& config, const TiledLevel& level);
+
+private:
+    const ResourceCache& resmgr;
+    std::string atlasTilesetName;
+    std::unique_ptr<AtlasRenderData> atlas;
+    std::string tileMapKey;
+    std::unique_ptr<ChunkedTileMap> tileMap;
+};
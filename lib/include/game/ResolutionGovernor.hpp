@@ -0,0 +1,50 @@
+#pragma once
+
+/// <summary>
+/// Picks the multiple of the internal resolution the world is rendered at,
+/// based on recent frame times.
+///
+/// Frame times are averaged over windows of WINDOW_FRAME_COUNT frames.
+/// A window over budget lowers the scale right away, the scale is raised
+/// only after several windows within budget in a row. Each time a raise
+/// has to be undone, the next one waits twice as long, so the scale
+/// doesn't oscillate on devices at the edge of the budget.
+/// </summary>
+class [[nodiscard]] ResolutionGovernor final
+{
+public:
+    static constexpr unsigned WINDOW_FRAME_COUNT = 30;
+    static constexpr unsigned MIN_WINDOWS_TO_RAISE = 4;
+    static constexpr unsigned MAX_WINDOWS_TO_RAISE = 64;
+
+public:
+    /// <summary>
+    /// Starts at the lowest scale and works its way up
+    /// </summary>
+    ResolutionGovernor(unsigned maxScale, float targetFrameTime) noexcept
+        : maxScale(maxScale < 1u ? 1u : maxScale)
+        , targetFrameTime(targetFrameTime)
+    {
+    }
+
+public:
+    /// <summary>
+    /// Returns true when the scale has changed
+    /// </summary>
+    bool update(float frameTime) noexcept;
+
+    [[nodiscard]] unsigned getScale() const noexcept
+    {
+        return scale;
+    }
+
+private:
+    unsigned maxScale = 1;
+    float targetFrameTime = 0.f;
+    unsigned scale = 1;
+    float windowTime = 0.f;
+    unsigned windowFrames = 0;
+    unsigned windowsWithinBudget = 0;
+    unsigned windowsToRaise = MIN_WINDOWS_TO_RAISE;
+    bool lastChangeWasRaise = false;
+};
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+/// <summary>
+/// Collects sprites sharing one texture (the level atlas) into a single
+/// vertex array, so they are submitted in one draw call regardless
+/// of how many there are.
+///
+/// Meant to be cleared and refilled every frame, the vertex array keeps
+/// its capacity, so refilling it doesn't allocate.
+/// </summary>
+class [[nodiscard]] SpriteBatch final : public sf::Drawable
+{
+public:
+    explicit SpriteBatch(const sf::Texture& texture) noexcept
+        : texture(texture), vertices(sf::PrimitiveType::Triangles)
+    {
+    }
+
+public:
+    void clear()
+    {
+        vertices.clear();
+    }
+
+    /// <summary>
+    /// Appends the sprite with its current transform, texture rect
+    /// and color. The sprite must use the texture of the batch.
+    /// </summary>
+    void add(const sf::Sprite& sprite);
+
+    [[nodiscard]] std::size_t getVertexCount() const noexcept
+    {
+        return vertices.getVertexCount();
+    }
+
+    [[nodiscard]] const sf::Vertex& operator[](std::size_t idx) const
+    {
+        return vertices[idx];
+    }
+
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+    const sf::Texture& texture;
+    sf::VertexArray vertices;
+};
@@ -1,9 +1,9 @@
 #pragma once
 
+#include "filesystem/ResourceCache.hpp"
 #include "input/Input.hpp"
 #include "settings/InputSettings.hpp"
 #include <DGM/classes/Objects.hpp>
-#include <DGM/classes/ResourceManager.hpp>
 #include <DGM/classes/Window.hpp>
 #include <SFML/Window/Event.hpp>
 
@@ -11,7 +11,7 @@ class [[nodiscard]] TouchControls final
 {
 public:
     TouchControls(
-        const dgm::ResourceManager& resmgr,
+        const ResourceCache& resmgr,
         Input& input,
         const InputSettings& settings,
         const sf::Vector2u& windowSize);
@@ -1,46 +1,96 @@
 #pragma once
 
+#include "filesystem/ResourceCache.hpp"
+#include "game/engine/VoiceAllocator.hpp"
 #include "game/events/AudioEvents.hpp"
-#include "settings/AudioSettings.hpp"
-#include <DGM/classes/ResourceManager.hpp>
 #include <SFML/Audio/Sound.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <optional>
+#include <vector>
 
+/// <summary>
+/// Plays game sounds on a fixed pool of voices.
+///
+/// Events only record what should be heard, update() then applies
+/// it once per frame. However many events of one kind arrive in a
+/// frame, they start at most one sound. The magnet buzz is a looping
+/// voice that plays for as long as magnet events keep coming, with
+/// gain following the magnet force.
+/// </summary>
 class AudioEngine
 {
 public:
-    AudioEngine(
-        const dgm::ResourceManager& resmgr,
-        const AudioSettings& settings) noexcept
-        : resmgr(resmgr), settings(settings)
-    {
-    }
+    static constexpr std::size_t VOICE_COUNT = 8;
+
+public:
+    AudioEngine(const ResourceCache& resmgr, float soundVolume);
 
 public:
-    inline void operator()(JoeMagnetizedToRedAudioEvent)
+    inline void operator()(const JoeMagnetizedToRedAudioEvent& event)
     {
-        playSound("buzzRed.wav", false);
+        requestBuzz(buzzRed, event.force);
     }
 
-    inline void operator()(JoeMagnetizedToBlueAudioEvent)
+    inline void operator()(const JoeMagnetizedToBlueAudioEvent& event)
     {
-        playSound("buzzBlue.wav", false);
+        requestBuzz(buzzBlue, event.force);
     }
 
     inline void operator()(JoeWonAudioEvent)
     {
-        playSound("win_fanfare.wav", true);
+        pending.won = true;
     }
 
     inline void operator()(JoeDiedAudioEvent)
     {
-        playSound("lose_fanfare.wav", true);
+        pending.died = true;
+    }
+
+    /// <summary>
+    /// Applies events received since the last update
+    /// </summary>
+    void update();
+
+    /// <summary>
+    /// Stops looping sounds, for when the game stops being updated
+    /// </summary>
+    void stopLoops();
+
+    /// <summary>
+    /// Applies to sounds started from now on and to the buzz
+    /// </summary>
+    void setSoundVolume(float volume) noexcept
+    {
+        soundVolume = volume;
     }
 
 private:
-    void playSound(const std::string& name, bool override);
+    struct [[nodiscard]] PendingSounds final
+    {
+        const sf::SoundBuffer* buzz = nullptr;
+        float buzzForce = 0.f;
+        bool won = false;
+        bool died = false;
+    };
+
+    void requestBuzz(const sf::SoundBuffer& buffer, float force) noexcept;
+
+    void updateBuzz(const sf::SoundBuffer& buffer, float force);
+
+    void playOnce(const sf::SoundBuffer& buffer, SoundPriority priority);
+
+    [[nodiscard]] std::optional<std::size_t>
+    acquireVoice(SoundPriority priority);
 
 private:
-    const dgm::ResourceManager& resmgr;
-    const AudioSettings& settings;
-    std::optional<sf::Sound> channel = std::nullopt;
+    float soundVolume = 100.f;
+    // Sound buffers are never evicted from the cache
+    const sf::SoundBuffer& buzzRed;
+    const sf::SoundBuffer& buzzBlue;
+    const sf::SoundBuffer& winFanfare;
+    const sf::SoundBuffer& loseFanfare;
+    std::vector<sf::Sound> voices;
+    VoiceAllocator allocator;
+    std::optional<std::size_t> buzzVoice = std::nullopt;
+    PendingSounds pending;
 };
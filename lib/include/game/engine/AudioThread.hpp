@@ -0,0 +1,94 @@
+#pragma once
+
+#include "game/engine/AudioEngine.hpp"
+#include "game/events/SpscRingBuffer.hpp"
+#include "settings/AudioSettings.hpp"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <variant>
+
+/// <summary>
+/// Runs the AudioEngine on its own thread. The game thread only
+/// copies commands into a lock-free ring buffer, so starting and
+/// stopping sounds doesn't add to the gameplay frame. The audio thread
+/// sleeps until a frame or loop stop is sent, never polls.
+///
+/// Every method except the constructor and destructor
+/// must be called from the thread that constructed the object.
+/// </summary>
+class [[nodiscard]] AudioThread final
+{
+public:
+    static constexpr std::size_t CHANNEL_CAPACITY = 256;
+
+public:
+    /// <summary>
+    /// Sound buffers are resolved before the thread starts,
+    /// the resource cache is not touched from the audio thread
+    /// </summary>
+    AudioThread(const ResourceCache& resmgr, const AudioSettings& settings);
+
+    AudioThread(AudioThread&&) = delete;
+    AudioThread(const AudioThread&) = delete;
+
+public:
+    /// <summary>
+    /// Visitor for EventQueue&lt;AudioEvent&gt;
+    /// </summary>
+    template<class Event>
+    void operator()(const Event& event)
+    {
+        send(AudioEvent(event));
+    }
+
+    /// <summary>
+    /// Events sent before this are applied together,
+    /// as AudioEngine::update does
+    /// </summary>
+    void endFrame();
+
+    void stopLoops();
+
+private:
+    struct [[nodiscard]] EndFrameCommand final
+    {
+    };
+
+    struct [[nodiscard]] StopLoopsCommand final
+    {
+    };
+
+    struct [[nodiscard]] SetSoundVolumeCommand final
+    {
+        float volume = 0.f;
+    };
+
+    using AudioCommand = std::variant<
+        AudioEvent,
+        EndFrameCommand,
+        StopLoopsCommand,
+        SetSoundVolumeCommand>;
+
+    /// <summary>
+    /// Commands that don't fit into the channel are dropped
+    /// and show up in the trace
+    /// </summary>
+    void send(AudioCommand&& command);
+
+    void wakeUp();
+
+    void run(std::stop_token stopToken);
+
+private:
+    const AudioSettings& settings;
+    float sentSoundVolume = 0.f;
+    // Only touched by the audio thread once it starts
+    AudioEngine engine;
+    SpscRingBuffer<AudioCommand, CHANNEL_CAPACITY> channel;
+    // Only guards the sleep, commands never wait for it
+    std::mutex wakeUpMutex;
+    std::condition_variable_any commandsSent;
+    // Declared last so the thread is joined before the engine dies
+    std::jthread thread;
+};
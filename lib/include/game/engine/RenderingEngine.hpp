@@ -1,13 +1,20 @@
 #pragma once
 
-#include "game/Box2d.hpp"
+#include "filesystem/ResourceCache.hpp"
+#include "game/BoxDebugRenderer.hpp"
 #include "game/GameConfig.hpp"
+#include "game/RenderCache.hpp"
+#include "game/ResolutionGovernor.hpp"
 #include "game/Scene.hpp"
+#include "game/SpriteBatch.hpp"
 #include "game/TiledLevel.hpp"
-#include "misc/FpsCounter.hpp"
+#include "misc/FrameProfiler.hpp"
 #include "settings/VideoSettings.hpp"
 #include "strings/StringProvider.hpp"
 #include <DGM/dgm.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <optional>
+#include <vector>
 
 class [[nodiscard]] SimpleAnimation final
 {
@@ -45,19 +52,21 @@ class [[nodiscard]] RenderingEngine final
 public:
     RenderingEngine(
         dgm::Window& window,
-        dgm::ResourceManager& resmgr,
+        ResourceCache& resmgr,
         const VideoSettings& settings,
         const StringProvider& strings,
         Scene& scene,
         const TiledLevel& level,
-        const GameConfig& config) noexcept;
+        const GameConfig& config,
+        RenderCache& renderCache,
+        FrameProfiler& profiler);
 
 public:
     void update(const dgm::Time& time);
 
     void draw(bool paused);
 
-    void renderWorld();
+    void renderWorld(sf::RenderTarget& target);
 
     void
     renderMagnetLine(const sf::Vector2f& joePos, const sf::Vector2f& direction);
@@ -66,30 +75,60 @@ public:
 
     void setJoeIdleState();
 
+private:
+    /// <summary>
+    /// Renders background and world into a texture at a multiple of
+    /// the internal resolution and stretches it over the window.
+    /// Returns false when the texture could not be (re)created.
+    /// </summary>
+    bool renderWorldScaled();
+
+    /// <summary>
+    /// Sizes and places HUD texts for the current UI scale
+    /// </summary>
+    void setupHudTexts();
+
+    void updateTimerText();
+
+    void renderProfilerStats();
+
 private:
     dgm::Window& window;
     const VideoSettings& settings;
     const StringProvider& strings;
     Scene& scene;
-    dgm::TextureAtlas atlas;
-    dgm::AnimationStates ballAnimationStates;
-    dgm::AnimationStates magnetLineAnimationStates;
-    dgm::Clip tileset;
+    AtlasRenderData& atlasData;
+    const ChunkedTileMap& tileMap;
+    FrameProfiler& profiler;
 
     BoxDebugRenderer boxDebugRenderer;
     dgm::Camera backgroundCamera;
     dgm::Camera worldCamera;
     dgm::Camera hudCamera;
-    FpsCounter fpsCounter;
+    ResolutionGovernor resolutionGovernor;
+    // Percentiles are recomputed only every few frames
+    unsigned framesUntilProfilerRefresh = 0;
     SimpleAnimation animation;
     std::string joeSkinName;
 
-    sf::Text text;
-    dgm::TileMap tileMap;
+    // Every text keeps its own geometry, which sf::Text only rebuilds
+    // when its string or style changes. World labels never change,
+    // the timer only when the displayed centiseconds do.
+    std::vector<sf::Text> labelTexts;
+    sf::Text timerText;
+    sf::String timerString;
+    std::optional<unsigned> displayedCentiseconds;
+    sf::Text promptText;
+    sf::Text profilerText;
     sf::Sprite sprite;
     sf::Sprite line;
+    // Joe and magnet lines, all cut from the level atlas
+    SpriteBatch worldBatch;
     sf::CircleShape spriteOutline;
     sf::Sprite background;
+    // Background and world when rendered at a lower resolution
+    sf::RenderTexture worldTexture;
+    sf::Sprite worldSprite;
 
     sf::Time timeToBlink = sf::Time::Zero;
     dgm::Animation joeAnimation;
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+enum class [[nodiscard]] SoundPriority : std::uint8_t
+{
+    Buzz,
+    Fanfare,
+};
+
+/// <summary>
+/// Decides which voice of a fixed pool plays the next sound.
+/// Idle voices are used first. When all voices are busy, the one
+/// with the lowest priority is stolen, the oldest of those first.
+/// Voices playing a higher priority than requested are never stolen.
+/// </summary>
+class [[nodiscard]] VoiceAllocator final
+{
+public:
+    explicit VoiceAllocator(std::size_t voiceCount) : voices(voiceCount) {}
+
+public:
+    /// <summary>
+    /// isPlaying(idx) tells whether voice idx is still busy,
+    /// returns nullopt when no voice may be used
+    /// </summary>
+    template<class IsPlaying>
+    [[nodiscard]] std::optional<std::size_t>
+    acquire(SoundPriority priority, IsPlaying&& isPlaying)
+    {
+        auto&& result = std::optional<std::size_t>();
+        for (std::size_t idx = 0; idx < voices.size() && !result; ++idx)
+        {
+            if (!isPlaying(idx)) result = idx;
+        }
+
+        if (!result)
+        {
+            for (std::size_t idx = 0; idx < voices.size(); ++idx)
+            {
+                if (voices[idx].priority > priority) continue;
+                if (!result || isStolenBefore(voices[idx], voices[*result]))
+                    result = idx;
+            }
+        }
+
+        if (result) voices[*result] = { priority, nextSerial++ };
+        return result;
+    }
+
+    [[nodiscard]] std::size_t getVoiceCount() const noexcept
+    {
+        return voices.size();
+    }
+
+private:
+    struct [[nodiscard]] VoiceState final
+    {
+        SoundPriority priority = SoundPriority::Buzz;
+        std::uint64_t serial = 0;
+    };
+
+    [[nodiscard]] static bool
+    isStolenBefore(const VoiceState& a, const VoiceState& b) noexcept
+    {
+        return a.priority < b.priority
+               || (a.priority == b.priority && a.serial < b.serial);
+    }
+
+private:
+    std::vector<VoiceState> voices;
+    std::uint64_t nextSerial = 0;
+};
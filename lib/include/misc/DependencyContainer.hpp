@@ -1,11 +1,17 @@
 #pragma once
 
 #include "filesystem/ResourceLoader.hpp"
+#include "game/Constants.hpp"
+#include "game/PreparedLevelCache.hpp"
+#include "game/RenderCache.hpp"
 #include "gui/Gui.hpp"
 #include "gui/Sizers.hpp"
 #include "input/Input.hpp"
 #include "input/VirtualCursor.hpp"
+#include "misc/FrameProfiler.hpp"
+#include "misc/JobSystem.hpp"
 #include "misc/Jukebox.hpp"
+#include "misc/Tracer.hpp"
 #include "settings/AppSettings.hpp"
 #include "strings/StringProvider.hpp"
 #include <DGM/dgm.hpp>
@@ -13,11 +19,17 @@
 struct [[nodiscard]] DependencyContainer final
 {
     Gui gui;
-    dgm::ResourceManager resmgr;
+    JobSystem jobs;
+    const AssetArchive archive;
+    ResourceCache resmgr;
+    const LevelPack levels;
     const StringProvider strings;
     Input input;
     VirtualCursor virtualCursor;
     Jukebox jukebox;
+    RenderCache renderCache;
+    PreparedLevelCache levelCache;
+    FrameProfiler profiler;
 
     DependencyContainer(
         dgm::Window& window,
@@ -28,15 +40,34 @@ struct [[nodiscard]] DependencyContainer final
         // since we need to have gui backend defined before
         // other tgui objects (like fonts) can be created.
         : gui(window)
-        , resmgr(ResourceLoader::loadResources(rootDir))
+        , archive(Tracer::measure(
+              "AssetArchive",
+              "startup",
+              [&] { return ResourceLoader::openArchive(rootDir); }))
+        , resmgr(Tracer::measure(
+              "ResourceCache",
+              "startup",
+              [&]
+              {
+                  return ResourceLoader::loadResources(
+                      rootDir, archive, LEVEL_ASSET_BUDGET, jobs);
+              }))
+        , levels(Tracer::measure(
+              "LevelPack",
+              "startup",
+              [&]
+              { return ResourceLoader::loadLevels(rootDir, archive, jobs); }))
         , strings(primaryLang)
         , input(settings.bindings)
         , virtualCursor(
               window.getSfmlWindowContext(),
               input,
               resmgr.get<sf::Texture>("cursor.png"))
-        , jukebox(resmgr, rootDir)
+        , jukebox(resmgr, archive, rootDir)
+        , renderCache(resmgr)
+        , levelCache(levels)
     {
+        auto&& trace = TraceScope("Gui setup", "startup");
         Sizers::setUiScale(settings.video.uiScale);
         gui.setFont(resmgr.get<tgui::Font>("pico-8-tgui.ttf"));
         // NOTE: You can create your own theme file and use it here
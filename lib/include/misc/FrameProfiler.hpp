@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+enum class [[nodiscard]] FramePhase
+{
+    Input,
+    GameRules,
+    Physics,
+    RenderWorld,
+    Hud,
+    Gui,
+    Display,
+};
+
+/// <summary>
+/// Time spent in every phase of the last CAPACITY frames.
+///
+/// Phases don't overlap, GameRules excludes the Box2D step reported
+/// as Physics and Display is the time between the end of one frame's
+/// drawing and the input polling of the next one.
+/// </summary>
+class [[nodiscard]] FrameProfiler final
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t CAPACITY = 512;
+    static constexpr std::size_t PHASE_COUNT =
+        static_cast<std::size_t>(FramePhase::Display) + 1;
+    static constexpr std::array<const char*, PHASE_COUNT> PHASE_NAMES = {
+        "input", "rules", "physics", "world", "hud", "gui", "display",
+    };
+
+    /// <summary>
+    /// In milliseconds
+    /// </summary>
+    struct [[nodiscard]] PhaseStats final
+    {
+        float min = 0.f;
+        float avg = 0.f;
+        float p95 = 0.f;
+        float p99 = 0.f;
+    };
+
+public:
+    /// <summary>
+    /// Starts a new frame, overwriting the oldest one once full
+    /// </summary>
+    void beginFrame() noexcept;
+
+    /// <summary>
+    /// Adds to the time of the phase in the current frame
+    /// </summary>
+    void record(FramePhase phase, Clock::duration duration) noexcept
+    {
+        record(
+            phase,
+            std::chrono::duration<float, std::milli>(duration).count());
+    }
+
+    void record(FramePhase phase, float milliseconds) noexcept
+    {
+        if (frameCount == 0) return;
+        samples[currentFrame][static_cast<std::size_t>(phase)] +=
+            milliseconds;
+    }
+
+    template<class Callable>
+    void measure(FramePhase phase, Callable&& callable)
+    {
+        const auto start = Clock::now();
+        callable();
+        record(phase, Clock::now() - start);
+    }
+
+    /// <summary>
+    /// Over completed frames, the current one is left out
+    /// </summary>
+    [[nodiscard]] PhaseStats computeStats(FramePhase phase) const noexcept;
+
+    /// <summary>
+    /// One line per frame from the oldest, times in milliseconds
+    /// </summary>
+    [[nodiscard]] std::string exportCsv() const;
+
+    [[nodiscard]] std::size_t getFrameCount() const noexcept
+    {
+        return frameCount;
+    }
+
+private:
+    std::array<std::array<float, PHASE_COUNT>, CAPACITY> samples = {};
+    std::size_t currentFrame = CAPACITY - 1;
+    std::size_t frameCount = 0;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// Fixed pool of worker threads executing submitted jobs in FIFO order
+/// </summary>
+class [[nodiscard]] JobSystem final
+{
+public:
+    explicit JobSystem(
+        unsigned threadCount =
+            std::max(1u, std::thread::hardware_concurrency()));
+
+    JobSystem(JobSystem&&) = delete;
+    JobSystem(const JobSystem&) = delete;
+
+public:
+    /// <summary>
+    /// Exceptions thrown by the job are rethrown from the future
+    /// </summary>
+    template<class Job>
+    [[nodiscard]] auto submit(Job&& job)
+    {
+        using Result = std::invoke_result_t<std::decay_t<Job>>;
+
+        // std::function needs a copyable target, packaged_task is move-only
+        auto&& task = std::make_shared<std::packaged_task<Result()>>(
+            std::forward<Job>(job));
+        auto&& future = task->get_future();
+
+        {
+            auto&& lock = std::scoped_lock(mutex);
+            jobs.emplace_back([task] { (*task)(); });
+        }
+        jobAvailable.notify_one();
+
+        return future;
+    }
+
+    [[nodiscard]] std::size_t getThreadCount() const noexcept
+    {
+        return workers.size();
+    }
+
+private:
+    void work(std::stop_token stopToken);
+
+private:
+    std::mutex mutex;
+    std::condition_variable_any jobAvailable;
+    std::deque<std::function<void()>> jobs;
+    // Declared last so workers are stopped and joined before the queue dies.
+    // Jobs that didn't start by then report broken promise to their futures.
+    std::vector<std::jthread> workers;
+};
@@ -1,41 +1,96 @@
+#pragma once
+
+#include "filesystem/AssetArchive.hpp"
+#include "filesystem/ResourceCache.hpp"
 #include "misc/Playlist.hpp"
-#include <DGM/classes/ResourceManager.hpp>
 #include <SFML/Audio/Music.hpp>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
 
+/// <summary>
+/// Plays background music from a worker thread.
+///
+/// Public methods only enqueue a command, so they never touch the disk
+/// or the music streams on the calling thread. The worker keeps the next
+/// song of each playlist opened in advance. A play request swaps in that
+/// song and crossfades it with the one that was playing, unless the
+/// same song is already playing.
+/// </summary>
 class [[nodiscard]] Jukebox final
 {
 public:
     Jukebox(
-        const dgm::ResourceManager& resmgr,
+        const ResourceCache& resmgr,
+        const AssetArchive& archive,
         const std::filesystem::path& rootDir);
 
+    Jukebox(Jukebox&&) = delete;
+    Jukebox(const Jukebox&) = delete;
+
 public:
     void playTitleTrack();
 
     void playIngameTrack();
 
-    void pause()
-    {
-        song.pause();
-    }
+    void pause();
+
+    void resume();
 
-    void resume()
+    void setVolume(float volume);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    enum class [[nodiscard]] TrackKind
     {
-        song.play();
-    }
+        Title,
+        Ingame,
+    };
 
-    void setVolume(float volume)
+    struct [[nodiscard]] Track final
     {
-        song.setVolume(volume);
-    }
+        std::string name;
+        std::unique_ptr<sf::Music> music;
+    };
+
+    void post(std::function<void()> command);
+
+    void work(std::stop_token stopToken);
 
-private:
     std::filesystem::path getSongPath(const std::string& songName) const;
 
-    void playSong(const std::string& songName);
+    [[nodiscard]] Track prefetch(TrackKind kind);
+
+    void play(TrackKind kind);
+
+    void updateCrossfade();
 
 private:
+    const AssetArchive& archive;
     const std::filesystem::path ROOT_DIR;
     Playlist playlist;
-    sf::Music song;
+
+    std::mutex mutex;
+    std::condition_variable_any commandAvailable;
+    std::deque<std::function<void()>> commands;
+
+    // Only touched by the worker
+    std::minstd_rand rng;
+    std::array<Track, 2> prefetched;
+    Track current;
+    Track fadingOut;
+    std::optional<Clock::time_point> crossfadeStart;
+    float volume = 100.f;
+    bool paused = false;
+
+    // Declared last so the worker is joined before the songs die
+    std::jthread worker;
 };
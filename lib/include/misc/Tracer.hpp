@@ -0,0 +1,99 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// Collects durations of startup and loading phases from any thread
+/// and exports them in the Chrome trace event format, which can be
+/// opened in chrome://tracing or ui.perfetto.dev
+/// </summary>
+class [[nodiscard]] Tracer final
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct [[nodiscard]] Event final
+    {
+        std::string name;
+        const char* category = "";
+        std::int64_t startUs = 0;
+        std::int64_t durationUs = 0;
+        std::size_t threadIdx = 0;
+    };
+
+    /// <summary>
+    /// Recording stops after this many events so a long session
+    /// can't grow the trace without bounds
+    /// </summary>
+    static constexpr std::size_t MAX_EVENT_COUNT = 65536;
+
+public:
+    static void record(
+        std::string name,
+        const char* category,
+        Clock::time_point start,
+        Clock::time_point end);
+
+    /// <summary>
+    /// Times the callable and returns its result
+    /// </summary>
+    template<class Callable>
+    static auto
+    measure(std::string name, const char* category, Callable&& callable)
+    {
+        const auto start = Clock::now();
+        if constexpr (std::is_void_v<std::invoke_result_t<Callable>>)
+        {
+            callable();
+            record(std::move(name), category, start, Clock::now());
+        }
+        else
+        {
+            auto&& result = callable();
+            record(std::move(name), category, start, Clock::now());
+            return result;
+        }
+    }
+
+    [[nodiscard]] static std::vector<Event> getEvents();
+
+    /// <summary>
+    /// JSON object with all recorded events as complete ("X") events
+    /// </summary>
+    [[nodiscard]] static std::string exportChromeTrace();
+
+    static void clear();
+};
+
+/// <summary>
+/// Records time from construction to destruction
+/// </summary>
+class [[nodiscard]] TraceScope final
+{
+public:
+    TraceScope(std::string name, const char* category)
+        : name(std::move(name)), category(category), start(Tracer::Clock::now())
+    {
+    }
+
+    TraceScope(TraceScope&&) = delete;
+    TraceScope(const TraceScope&) = delete;
+
+    ~TraceScope()
+    {
+        Tracer::record(
+            std::move(name), category, start, Tracer::Clock::now());
+    }
+
+private:
+    std::string name;
+    const char* category;
+    Tracer::Clock::time_point start;
+};
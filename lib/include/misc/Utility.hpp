@@ -2,12 +2,21 @@
 
 #include "misc/Compatibility.hpp"
 #include <settings/SaveState.hpp>
+#include <span>
+#include <string_view>
 
 class [[nodiscard]] Utility final
 {
 public:
     static std::string formatTime(const float value);
 
+    /// <summary>
+    /// Allocation-free variant, the result views into the buffer
+    /// and is cut off if the buffer is too small
+    /// </summary>
+    static std::string_view
+    formatTime(const float value, std::span<char> buffer);
+
     static std::optional<float>
     getBestTime(SaveState& save, const size_t levelIdx);
 
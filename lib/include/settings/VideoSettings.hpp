@@ -21,7 +21,17 @@ struct [[nodiscard]] VideoSettings final
         true;
 #endif
     float uiScale = 1.f;
+    // Background and world are rendered at a resolution picked
+    // from frame times instead of the window resolution
+    bool dynamicResolution =
+#ifdef ANDROID
+        true;
+#else
+        false;
+#endif
     bool renderColliders = false;
+    // Fattened AABBs of the broadphase tree, on top of colliders
+    bool renderColliderBounds = false;
     bool showFps =
 #ifdef _DEBUG
         true;
@@ -35,5 +45,6 @@ namespace sf
     NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(Vector2u, x, y);
 }
 
-NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(
-    VideoSettings, resolution, fullscreen, uiScale, showFps);
+// Settings saved before a field existed keep its default
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(
+    VideoSettings, resolution, fullscreen, uiScale, dynamicResolution, showFps);
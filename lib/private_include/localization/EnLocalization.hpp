@@ -32,8 +32,10 @@ const std::map<StringId, StringViewType> EN_LOCALIZATION = {
     { EnableFullscreen, "fullscreen" },
     { SetResolution, "resolution" },
     { SetUiScale, "set ui scale" },
+    { DynamicResolution, "dynamic resolution" },
     { SetTheme, "set theme" },
     { RenderColliders, "render box2d colliders" },
+    { RenderColliderBounds, "render collider bounds" },
     { ShowFPS, "show fps" },
     { SoundVolume, "sound volume" },
     { MusicVolume, "music volume" },
@@ -4,8 +4,10 @@
 #include "appstate/AppStatePause.hpp"
 #include "appstate/Messaging.hpp"
 #include "filesystem/models/TiledModels.hpp"
+#include "game/Constants.hpp"
 #include "game/SceneBuilder.hpp"
 #include "misc/Compatibility.hpp"
+#include "misc/Tracer.hpp"
 #include "misc/Utility.hpp"
 #include "types/Overloads.hpp"
 #include <ranges>
@@ -35,15 +37,19 @@ AppStateGame::AppStateGame(
     , settings(settings)
     , config(config)
     , touchControls(dic.resmgr, dic.input, settings.input, app.window.getSize())
+    , level(Tracer::measure(
+          "PreparedLevel",
+          "level",
+          [&] { return dic.levelCache.get(config.levelResourceName); }))
     , game(
-          SceneBuilder::convertToTiledLevel(
-              dic.resmgr.get<tiled::FiniteMapModel>(config.levelResourceName)),
-          dic.input,
+          *level,
           app.window,
           dic.resmgr,
           settings,
           dic.strings,
-          config)
+          config,
+          dic.renderCache,
+          dic.profiler)
 {
     dic.input.reset();
 
@@ -60,10 +66,21 @@ AppStateGame::AppStateGame(
 }
 
 void AppStateGame::input()
+{
+    auto&& profiler = dic.profiler;
+    if (lastDrawEnd)
+        profiler.record(
+            FramePhase::Display, FrameProfiler::Clock::now() - *lastDrawEnd);
+    profiler.beginFrame();
+    profiler.measure(FramePhase::Input, [&] { pollInput(); });
+}
+
+void AppStateGame::pollInput()
 {
     if (dic.input.isBackButtonPressed())
     {
         paused = true;
+        game.audioThread.stopLoops();
         app.pushState<AppStatePause>(dic, settings);
     }
 
@@ -95,9 +112,24 @@ void AppStateGame::input()
 
 void AppStateGame::update()
 {
-    game.gameRulesEngine.update(app.time);
+    const auto updateStart = FrameProfiler::Clock::now();
+    game.gameRulesEngine.update(
+        app.time.getDeltaTime(),
+        GameInput {
+            .start = !game.scene.playing && dic.input.shouldStart(),
+            .magnetizeRed = dic.input.isMagnetizingRed(),
+            .magnetizeBlue = dic.input.isMagnetizingBlue(),
+        });
     game.renderingEngine.update(app.time);
 
+    // The Box2D step is reported on its own, not as part of the rules
+    const auto physicsMs = game.gameRulesEngine.getPhysicsMilliseconds();
+    const auto updateMs = std::chrono::duration<float, std::milli>(
+                              FrameProfiler::Clock::now() - updateStart)
+                              .count();
+    dic.profiler.record(FramePhase::GameRules, updateMs - physicsMs);
+    dic.profiler.record(FramePhase::Physics, physicsMs);
+
     if (game.scene.contactListener->won)
     {
         game.audioEvents.pushEvent<JoeWonAudioEvent>();
@@ -107,7 +139,8 @@ void AppStateGame::update()
         game.audioEvents.pushEvent<JoeDiedAudioEvent>();
     }
 
-    game.audioEvents.processEvents(game.audioEngine);
+    game.audioEvents.processEvents(game.audioThread);
+    game.audioThread.endFrame();
 
     if (game.scene.contactListener->died)
     {
@@ -126,7 +159,7 @@ void AppStateGame::update()
             EndLevelState {
                 .levelWon = true,
                 .levelIdx = config.levelIdx,
-                .levelTime = game.scene.timer,
+                .levelTime = game.scene.timer * SIMULATION_TIMESTEP,
             });
     }
 }
@@ -134,16 +167,37 @@ void AppStateGame::update()
 void AppStateGame::draw()
 {
     game.renderingEngine.draw(paused);
-    if (!paused) touchControls.draw(app.window);
+    if (!paused)
+        dic.profiler.measure(
+            FramePhase::Gui, [&] { touchControls.draw(app.window); });
+
+    // Presenting the frame happens in dgm::App after this returns
+    lastDrawEnd = paused
+                      ? std::nullopt
+                      : std::optional(FrameProfiler::Clock::now());
 }
 
 void AppStateGame::restoreFocusImpl(const std::string& msg)
 {
     paused = false;
     // Empty message means returning from pause menu
-    if (!msg.empty())
-        app.popState(msg);
-    else
+    if (msg.empty())
+    {
         // Settings might have changed touch button scaling
         touchControls.regenerateButtons(app.window.getSize(), settings.input);
+        return;
+    }
+
+    auto message = Messaging::deserialize(msg);
+    if (message && std::holds_alternative<RestartLevel>(*message))
+        restartLevel();
+    else
+        app.popState(msg);
+}
+
+void AppStateGame::restartLevel()
+{
+    game.gameRulesEngine.restoreSnapshot(game.scene.spawnSnapshot);
+    game.renderingEngine.setJoeIdleState();
+    dic.input.reset();
 }
@@ -2,6 +2,7 @@
 #include "appstate/AppStateGame.hpp"
 #include "appstate/Messaging.hpp"
 #include "filesystem/models/TiledModels.hpp"
+#include "misc/Tracer.hpp"
 
 AppStateGameWrapper::AppStateGameWrapper(
     dgm::App& app,
@@ -14,7 +15,13 @@ AppStateGameWrapper::AppStateGameWrapper(
 
 void AppStateGameWrapper::input()
 {
-    app.pushState<AppStateGame>(dic, settings, config);
+    // No game is running at this point, so nothing references
+    // the backgrounds and tilesets that may be evicted
+    dic.resmgr.evictOverBudget();
+    Tracer::measure(
+        "AppStateGame " + config.levelResourceName,
+        "level",
+        [&] { app.pushState<AppStateGame>(dic, settings, config); });
     config.canShowHint = false;
 }
 
@@ -3,7 +3,6 @@
 #include "appstate/CommonHandler.hpp"
 #include "appstate/Messaging.hpp"
 #include "filesystem/AppStorage.hpp"
-#include "filesystem/models/TiledModels.hpp"
 #include "game/Constants.hpp"
 #include "gui/Builders.hpp"
 #include "misc/Utility.hpp"
@@ -23,10 +22,20 @@ AppStateLevelSelect::AppStateLevelSelect(
     : dgm::AppState(app)
     , dic(dic)
     , settings(settings)
-    , levelIds(dic.resmgr.getLoadedResourceIds<tiled::FiniteMapModel>().value())
+    , levelIds(dic.levels.getLevelIds())
+    , tabs { LevelTab { .name = StringId::Grasslands,
+                        .backgroundName = "background-forest.png",
+                        .startIdx = 0 },
+             LevelTab { .name = StringId::Factory,
+                        .backgroundName = "background-city.png",
+                        .startIdx = LEVELS_PER_TAB },
+             LevelTab { .name = StringId::LostLevels,
+                        .backgroundName = "background-forest.png",
+                        .startIdx = 2 * LEVELS_PER_TAB } }
     , lastSelectedTab(dic.strings.getString(StringId::Grasslands))
 {
-    std::ranges::sort(levelIds);
+    static_assert(DIFFICULTY_REMAPPER.size() == TAB_COUNT * LEVELS_PER_TAB);
+
     content = WidgetBuilder::createPanel();
     buildLayout();
 }
@@ -52,7 +61,20 @@ void AppStateLevelSelect::restoreFocusImpl(const std::string& message)
     if (msg)
         std::visit(
             overloads {
-                [&](PopIfNotLevelSelection) { buildLayout(); },
+                [&](PopIfNotLevelSelection)
+                {
+                    // The layout outlives the game that replaced it, only
+                    // cards of beaten levels need to change. Sizes are
+                    // fixed when built, so a new UI scale needs a rebuild.
+                    if (settings.video.uiScale != builtUiScale)
+                    {
+                        buildLayout();
+                        return;
+                    }
+
+                    refreshLevelCards();
+                    dic.gui.rebuildWith(layout);
+                },
                 [&](auto) { app.popState(message); },
             },
             *msg);
@@ -64,28 +86,29 @@ void AppStateLevelSelect::onTabClicked(const tgui::String& tabName)
 {
     lastSelectedTab = tabName;
 
-    if (tabName == dic.strings.getString(StringId::Grasslands))
-    {
-        buildContentGrasslands();
-    }
-    else if (tabName == dic.strings.getString(StringId::Factory))
+    for (auto&& tab : tabs)
     {
-        buildContentFactory();
-    }
-    else if (tabName == dic.strings.getString(StringId::LostLevels))
-    {
-        buildContentLostLevels();
-    }
-    else
-    {
-        throw std::runtime_error(
-            uni::format("Unsupported tab name {}", tabName.toStdString()));
+        if (tabName != dic.strings.getString(tab.name)) continue;
+
+        layout->getRenderer()->setTextureBackground(
+            dic.resmgr.get<tgui::Texture>(tab.backgroundName));
+        content->removeAllWidgets();
+        content->add(tab.grid);
+        return;
     }
+
+    throw std::runtime_error(
+        uni::format("Unsupported tab name {}", tabName.toStdString()));
 }
 
 void AppStateLevelSelect::buildLayout()
 {
-    dic.gui.rebuildWith(
+    builtUiScale = settings.video.uiScale;
+    for (auto&& tab : tabs)
+        tab.grid = buildLevelCards(tab.startIdx);
+    refreshLevelCards();
+
+    layout =
         DefaultLayoutBuilder()
             .withBackgroundImage(
                 dic.resmgr.get<sf::Texture>("background-forest.png"))
@@ -112,90 +135,37 @@ void AppStateLevelSelect::buildLayout()
             .withBottomLeftButton(WidgetBuilder::createButton(
                 dic.strings.getString(StringId::Back), [&] { app.popState(); }))
             .withNoBottomRightButton()
-            .build());
+            .build();
+    dic.gui.rebuildWith(layout);
 
-    auto tabs = dic.gui.get<tgui::Tabs>("LevelSelectTabs");
-    tabs->deselect();
-    tabs->select(lastSelectedTab);
-    //    buildContentGrasslands();
+    auto tabsWidget = dic.gui.get<tgui::Tabs>("LevelSelectTabs");
+    tabsWidget->deselect();
+    tabsWidget->select(lastSelectedTab);
 }
 
-void AppStateLevelSelect::buildLevelCards(
-    const size_t startIdx,
-    const size_t columnCount,
-    const size_t rowCount) const
+tgui::Grid::Ptr AppStateLevelSelect::buildLevelCards(const size_t startIdx)
 {
     auto&& grid = tgui::Grid::create();
     grid->setSize({ "100%", "100%" });
 
-    auto&& bestTimes =
-        std::vector<std::optional<float>>(columnCount * rowCount, std::nullopt);
-
-    for (unsigned y = 0; y < rowCount; ++y)
+    for (size_t y = 0; y < ROW_COUNT; ++y)
     {
-        for (unsigned x = 0; x < columnCount; ++x)
+        for (size_t x = 0; x < COLUMN_COUNT; ++x)
         {
-            const auto levelIdx = y * columnCount + x + startIdx;
-            if (levelIdx >= DIFFICULTY_REMAPPER.size()) break;
-
-            bestTimes[levelIdx - startIdx] =
-                Utility::getBestTime(settings.save, levelIdx);
-
-            const bool isUnlocked =
-                levelIdx == startIdx
-                || bestTimes[levelIdx - startIdx - 1].has_value()
-                || (y > 0
-                    && bestTimes[levelIdx - startIdx - columnCount]
-                           .has_value());
             grid->addWidget(
-                buildLevelCard(
-                    levelIdx, isUnlocked, bestTimes[levelIdx - startIdx]),
-                y,
-                x);
+                buildLevelCard(startIdx + y * COLUMN_COUNT + x),
+                static_cast<unsigned>(y),
+                static_cast<unsigned>(x));
         }
     }
 
-    content->removeAllWidgets();
-    content->add(grid);
-}
-
-void AppStateLevelSelect::buildContentGrasslands() const
-{
-    dic.gui.get<tgui::Panel>("RootContainer")
-        ->getRenderer()
-        ->setTextureBackground(
-            dic.resmgr.get<tgui::Texture>("background-forest.png"));
-    buildLevelCards(0, 5, 3);
-}
-
-void AppStateLevelSelect::buildContentFactory() const
-{
-    dic.gui.get<tgui::Panel>("RootContainer")
-        ->getRenderer()
-        ->setTextureBackground(
-            dic.resmgr.get<tgui::Texture>("background-city.png"));
-    buildLevelCards(15, 5, 3);
-}
-
-void AppStateLevelSelect::buildContentLostLevels() const
-{
-    dic.gui.get<tgui::Panel>("RootContainer")
-        ->getRenderer()
-        ->setTextureBackground(
-            dic.resmgr.get<tgui::Texture>("background-forest.png"));
-    buildLevelCards(30, 5, 3);
+    return grid;
 }
 
-tgui::Container::Ptr AppStateLevelSelect::buildLevelCard(
-    size_t levelIdx,
-    bool isUnlocked,
-    const std::optional<float>& bestTime) const
+tgui::Panel::Ptr AppStateLevelSelect::buildLevelCard(size_t levelIdx)
 {
-    auto&& card = WidgetBuilder::createPanel(
-        { "16%", "30%" }, bestTime ? COLOR_ORANGE : COLOR_DARK_GREY);
+    auto&& card = WidgetBuilder::createPanel({ "16%", "30%" });
     card->getRenderer()->setBorders({ 2.f });
-    card->getRenderer()->setBorderColor(
-        isUnlocked ? COLOR_YELLOW : COLOR_BLACK);
 
     auto&& headerPanel = WidgetBuilder::createPanel({ "100%", "40%" });
     auto&& timePanel = WidgetBuilder::createPanel({ "100%", "30%" });
@@ -205,53 +175,98 @@ tgui::Container::Ptr AppStateLevelSelect::buildLevelCard(
 
     card->add(headerPanel);
     card->add(timePanel);
+    card->add(buttonPanel);
 
-    if (isUnlocked) card->add(buttonPanel);
+    auto&& timeLabel = WidgetBuilder::createTextLabel("", "justify"_true);
+    headerPanel->add(WidgetBuilder::createTextLabel(
+        std::to_string(levelIdx + 1), "justify"_true));
+    timePanel->add(timeLabel);
+    buttonPanel->add(WidgetBuilder::createButton(
+        dic.strings.getString(StringId::PlayButton),
+        [&, levelIdx] { startLevel(levelIdx); }));
 
-    auto&& timeText = std::string("--:--");
-    if (bestTime) timeText = Utility::formatTime(bestTime.value());
-    if (!isUnlocked) timeText = dic.strings.getString(StringId::Locked);
+    card->onClick(
+        [&, levelIdx]
+        {
+            if (levelCards[levelIdx].isUnlocked) startLevel(levelIdx);
+        });
 
-    auto&& createLabel = [&](const std::string& str)
-    {
-        auto&& label = WidgetBuilder::createTextLabel(str, "justify"_true);
-        return label;
+    auto&& levelCard = levelCards[levelIdx];
+    levelCard = LevelCard {
+        .panel = card,
+        .timeLabel = timeLabel,
+        .buttonPanel = buttonPanel,
     };
+    updateLevelCard(levelCard);
+
+    return card;
+}
 
-    auto onClick = [&, idx = levelIdx]
+void AppStateLevelSelect::refreshLevelCards()
+{
+    for (auto&& tab : tabs)
     {
-        const std::array<std::string, 4u> JOES = {
-            "base",
-            "metal",
-            "voltorb",
-            "zombie"
-        };
-
-        bool useGrass = idx < 15 || idx >= 30 && idx % 2 == 0;
-        dic.jukebox.playIngameTrack();
-        app.pushState<AppStateGameWrapper>(
-            dic,
-            settings,
-            GameConfig {
-                .levelIdx = idx,
-                .levelResourceName = levelIds
-                    [idx < DIFFICULTY_REMAPPER.size()
-                         ? DIFFICULTY_REMAPPER[idx] - 1
-                         : idx],
-                .tilesetName =
-                    useGrass ? "grass_tileset.png" : "metal_tileset.png",
-                .joeSkinName = JOES[rand() % JOES.size()],
-                .backgroundName =
-                    useGrass ? "background-forest.png" : "background-city.png",
-            });
-    };
+        for (size_t i = 0; i < LEVELS_PER_TAB; ++i)
+        {
+            const auto levelIdx = tab.startIdx + i;
+            const auto bestTime = Utility::getBestTime(settings.save, levelIdx);
 
-    headerPanel->add(createLabel(std::to_string(levelIdx + 1)));
-    timePanel->add(createLabel(timeText));
-    buttonPanel->add(WidgetBuilder::createButton(
-        dic.strings.getString(StringId::PlayButton), onClick));
+            // Cards are visited in order, so the previous ones
+            // already hold their fresh times
+            const bool isUnlocked =
+                i == 0 || levelCards[levelIdx - 1].bestTime.has_value()
+                || (i >= COLUMN_COUNT
+                    && levelCards[levelIdx - COLUMN_COUNT]
+                           .bestTime.has_value());
 
-    if (isUnlocked) card->onClick(onClick);
+            auto&& card = levelCards[levelIdx];
+            if (card.bestTime == bestTime && card.isUnlocked == isUnlocked)
+                continue;
 
-    return card;
+            card.bestTime = bestTime;
+            card.isUnlocked = isUnlocked;
+            updateLevelCard(card);
+        }
+    }
+}
+
+void AppStateLevelSelect::updateLevelCard(const LevelCard& card) const
+{
+    card.panel->getRenderer()->setBackgroundColor(
+        card.bestTime ? COLOR_ORANGE : COLOR_DARK_GREY);
+    card.panel->getRenderer()->setBorderColor(
+        card.isUnlocked ? COLOR_YELLOW : COLOR_BLACK);
+    card.buttonPanel->setVisible(card.isUnlocked);
+
+    auto&& timeText = std::string("--:--");
+    if (card.bestTime) timeText = Utility::formatTime(card.bestTime.value());
+    if (!card.isUnlocked) timeText = dic.strings.getString(StringId::Locked);
+    card.timeLabel->setText(timeText);
+}
+
+void AppStateLevelSelect::startLevel(size_t levelIdx)
+{
+    const std::array<std::string, 4u> JOES = {
+        "base",
+        "metal",
+        "voltorb",
+        "zombie"
+    };
+
+    bool useGrass = levelIdx < 15 || levelIdx >= 30 && levelIdx % 2 == 0;
+    dic.jukebox.playIngameTrack();
+    app.pushState<AppStateGameWrapper>(
+        dic,
+        settings,
+        GameConfig {
+            .levelIdx = levelIdx,
+            .levelResourceName = levelIds
+                [levelIdx < DIFFICULTY_REMAPPER.size()
+                     ? DIFFICULTY_REMAPPER[levelIdx] - 1
+                     : levelIdx],
+            .tilesetName = useGrass ? "grass_tileset.png" : "metal_tileset.png",
+            .joeSkinName = JOES[rand() % JOES.size()],
+            .backgroundName =
+                useGrass ? "background-forest.png" : "background-city.png",
+        });
 }
@@ -13,6 +13,7 @@ AppStateMainMenu::AppStateMainMenu(
     app.window.getSfmlWindowContext().setFramerateLimit(120);
     buildLayout();
     dic.jukebox.playTitleTrack();
+    dic.levelCache.prepareAllInBackground();
 }
 
 void AppStateMainMenu::input()
@@ -116,6 +116,12 @@ void AppStateOptions::buildLayout()
                     }),
                 WidgetBuilder::createButton(
                     dic.strings.getString(StringId::Apply), [&] { refresh(); }))
+            .addOption(
+                dic.strings.getString(StringId::DynamicResolution),
+                WidgetBuilder::createCheckbox(
+                    settings.video.dynamicResolution,
+                    [&](bool value)
+                    { settings.video.dynamicResolution = value; }))
 
 #ifdef ANDROID
             .addOption(
@@ -184,6 +190,12 @@ void AppStateOptions::buildLayout()
                     settings.video.renderColliders,
                     [&](bool value)
                     { settings.video.renderColliders = value; }))
+            .addOption(
+                dic.strings.getString(StringId::RenderColliderBounds),
+                WidgetBuilder::createCheckbox(
+                    settings.video.renderColliderBounds,
+                    [&](bool value)
+                    { settings.video.renderColliderBounds = value; }))
             .addOption(
                 dic.strings.getString(StringId::ShowFPS),
                 WidgetBuilder::createCheckbox(
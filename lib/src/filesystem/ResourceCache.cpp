@@ -0,0 +1,90 @@
+#include "filesystem/ResourceCache.hpp"
+#include "misc/Tracer.hpp"
+#include <algorithm>
+#include <vector>
+
+void ResourceCache::evictOverBudget()
+{
+    if (evictableByteSize <= budget) return;
+
+    using EntryItr = std::map<std::string, Entry>::iterator;
+    auto&& candidates = std::vector<std::pair<LazyType*, EntryItr>>();
+    for (auto&& [_, type] : lazyTypes)
+    {
+        for (auto itr = type.entries.begin(); itr != type.entries.end(); ++itr)
+        {
+            if (itr->second.evictable) candidates.emplace_back(&type, itr);
+        }
+    }
+
+    std::ranges::sort(
+        candidates,
+        [](auto&& a, auto&& b)
+        { return a.second->second.lastUse < b.second->second.lastUse; });
+
+    for (auto&& [type, itr] : candidates)
+    {
+        if (evictableByteSize <= budget) break;
+        evictableByteSize -= itr->second.byteSize;
+        type->entries.erase(itr);
+    }
+}
+
+void* ResourceCache::acquire(LazyType& type, const std::string& id) const
+{
+    auto&& itr = type.entries.find(id);
+    if (itr == type.entries.end())
+    {
+        auto&& trace = TraceScope(id, "resource");
+        return store(type, id, type.finalize(type.decode(type.directory / id)));
+    }
+
+    itr->second.lastUse = ++useCounter;
+    return itr->second.resource.get();
+}
+
+void* ResourceCache::store(
+    LazyType& type,
+    const std::string& id,
+    std::shared_ptr<void> resource) const
+{
+    auto&& entry = Entry {
+        .resource = std::move(resource),
+        .lastUse = ++useCounter,
+        .evictable = type.isEvictable(id),
+    };
+    entry.byteSize = type.getByteSize(entry.resource.get());
+    if (entry.evictable) evictableByteSize += entry.byteSize;
+
+    auto&& itr = type.entries.emplace(id, std::move(entry)).first;
+    return itr->second.resource.get();
+}
+
+void ResourceCache::preload(
+    JobSystem& jobs, LazyType& type, const std::vector<std::string>& ids)
+{
+    auto&& pending = std::vector<
+        std::pair<std::string, std::future<std::shared_ptr<void>>>>();
+    for (auto&& id : ids)
+    {
+        if (type.entries.contains(id)) continue;
+
+        // Entries of the map never move, so the job can refer to the type
+        pending.emplace_back(
+            id,
+            jobs.submit(
+                [&type, path = type.directory / id]
+                {
+                    auto&& trace = TraceScope(
+                        "decode " + path.filename().string(), "resource");
+                    return type.decode(path);
+                }));
+    }
+
+    for (auto&& [id, decoded] : pending)
+    {
+        auto&& result = decoded.get();
+        auto&& trace = TraceScope("finalize " + id, "resource");
+        store(type, id, type.finalize(std::move(result)));
+    }
+}
@@ -1,31 +1,68 @@
 #include "filesystem/ResourceLoader.hpp"
 #include "filesystem/AppStorage.hpp"
 #include "filesystem/TiledLoader.hpp"
+#include "game/SceneBuilder.hpp"
 #include "gui/TguiHelper.hpp"
 #include "misc/Compatibility.hpp"
 #include "misc/Playlist.hpp"
+#include "misc/Tracer.hpp"
 #include <TGUI/Backend/SFML-Graphics.hpp>
 #include <TGUI/TGUI.hpp>
 #include <expected>
 
-static std::expected<tgui::Texture, dgm::Error>
-loadTguiTexture(const std::filesystem::path& path)
+static std::string_view toText(std::span<const std::byte> data)
 {
-    try
-    {
-        return tgui::Texture(path.string());
-    }
-    catch (const std::exception& ex)
-    {
-        return std::unexpected(dgm::Error(ex.what()));
-    }
+    return { reinterpret_cast<const char*>(data.data()), data.size() };
+}
+
+// Decoding images is CPU only and may run on a worker thread,
+// uploading them to the GPU happens on the main thread
+static std::expected<sf::Image, dgm::Error>
+decodeImage(const AssetArchive& archive, const std::filesystem::path& path)
+{
+    auto&& image = sf::Image();
+    auto&& data = archive.find(path);
+    if (data ? !image.loadFromMemory(data->data(), data->size())
+             : !image.loadFromFile(path))
+        return std::unexpected(dgm::Error(
+            uni::format("Could not decode image {}", path.string())));
+    return image;
+}
+
+static sf::Texture uploadTexture(sf::Image&& image)
+{
+    return sf::Texture(image);
+}
+
+static tgui::Texture uploadTguiTexture(sf::Image&& image)
+{
+    auto&& texture = tgui::Texture();
+    texture.loadFromPixelData(image.getSize(), image.getPixelsPtr());
+    return texture;
+}
+
+// Fonts are read lazily by the glyph rasterizer, so the memory they are
+// opened from must outlive them. The archive lives as long as the app.
+static std::expected<sf::Font, dgm::Error>
+loadFont(const AssetArchive& archive, const std::filesystem::path& path)
+{
+    auto&& data = archive.find(path);
+    if (!data) return dgm::Utility::loadFont(path);
+
+    auto&& font = sf::Font();
+    if (!font.openFromMemory(data->data(), data->size()))
+        return std::unexpected(dgm::Error(
+            uni::format("Could not open font {}", path.string())));
+    return font;
 }
 
 static std::expected<tgui::Font, dgm::Error>
-loadTguiFont(const std::filesystem::path& path)
+loadTguiFont(const AssetArchive& archive, const std::filesystem::path& path)
 {
     try
     {
+        if (auto&& data = archive.find(path))
+            return tgui::Font(data->data(), data->size());
         return tgui::Font(path.string());
     }
     catch (const std::exception& ex)
@@ -47,24 +84,23 @@ loadTguiTheme(const std::filesystem::path& path)
     }
 }
 
-static std::expected<tiled::FiniteMapModel, dgm::Error>
-loadTiledMap(const std::filesystem::path& path)
+static std::expected<std::filesystem::path, dgm::Error>
+getPath(const std::filesystem::path& path)
 {
-    try
-    {
-        return TiledLoader::loadLevel(path);
-    }
-    catch (const std::exception& ex)
-    {
-        return std::unexpected { dgm::Error(ex.what()) };
-    }
+    return path;
 }
 
 static std::expected<Playlist, dgm::Error>
-loadPlaylist(const std::filesystem::path& path)
+loadPlaylist(const AssetArchive& archive, const std::filesystem::path& path)
 {
     try
     {
+        if (auto&& data = archive.find(path))
+        {
+            Playlist playlist = nlohmann::json::parse(toText(*data));
+            return playlist;
+        }
+
         auto loaded = dgm::Utility::loadAssetAllText(path);
         if (!loaded) return std::unexpected(loaded.error());
         Playlist playlist = nlohmann::json::parse(loaded.value());
@@ -76,11 +112,82 @@ loadPlaylist(const std::filesystem::path& path)
     }
 }
 
-void preprocessUiIcons(
-    const std::string& resourceName, dgm::ResourceManager& resmgr)
+static std::expected<sf::SoundBuffer, dgm::Error>
+loadSound(const AssetArchive& archive, const std::filesystem::path& path)
+{
+    auto&& data = archive.find(path);
+    if (!data) return dgm::Utility::loadSound(path);
+
+    auto&& buffer = sf::SoundBuffer();
+    if (!buffer.loadFromMemory(data->data(), data->size()))
+        return std::unexpected(dgm::Error(
+            uni::format("Could not decode sound {}", path.string())));
+    return buffer;
+}
+
+static bool isLevelSpecific(const std::string& id)
+{
+    return id.starts_with("background-") || id.contains("_tileset.png");
+}
+
+static std::size_t getTextureByteSize(const sf::Texture& texture)
+{
+    return std::size_t(texture.getSize().x) * texture.getSize().y * 4;
+}
+
+static std::size_t getTguiTextureByteSize(const tgui::Texture& texture)
+{
+    return std::size_t(texture.getImageSize().x) * texture.getImageSize().y
+           * 4;
+}
+
+static std::size_t getSoundBufferByteSize(const sf::SoundBuffer& buffer)
+{
+    return buffer.getSampleCount() * sizeof(std::int16_t);
+}
+
+// Files held by the archive don't ship loose next to it, so they are
+// listed from its index instead of the asset directory
+template<class T, class Loader>
+static std::expected<void, dgm::Error> loadResourcesFromDirectory(
+    dgm::ResourceManager& resmgr,
+    const AssetArchive& archive,
+    const std::filesystem::path& assetDir,
+    const std::string& directory,
+    Loader&& loader,
+    const std::vector<std::string>& extensions)
+{
+    if (archive.isEmpty())
+    {
+        auto&& result = resmgr.loadResourcesFromDirectory<T>(
+            assetDir / directory, loader, extensions);
+        if (!result) return std::unexpected(result.error());
+        return {};
+    }
+
+    for (auto&& filePath : archive.getFilePaths())
+    {
+        const auto path = std::filesystem::path(filePath);
+        if (path.parent_path() != directory
+            || std::ranges::find(extensions, path.extension().string())
+                   == extensions.end())
+            continue;
+
+        auto&& loaded = loader(assetDir / path);
+        if (!loaded) return std::unexpected(loaded.error());
+
+        auto&& inserted = resmgr.insertResource<T>(
+            path.filename().string(), std::move(loaded.value()));
+        if (!inserted) return std::unexpected(inserted.error());
+    }
+
+    return {};
+}
+
+void preprocessUiIcons(const std::string& resourceName, ResourceCache& resmgr)
 {
-    auto texture = resmgr.get<sf::Texture>(resourceName);
-    auto clip = resmgr.get<dgm::Clip>(resourceName + ".clip");
+    auto&& texture = resmgr.get<sf::Texture>(resourceName);
+    auto&& clip = resmgr.get<dgm::Clip>(resourceName + ".clip");
 
     for (auto&& frameIdx : std::views::iota(0u, clip.getFrameCount()))
     {
@@ -91,97 +198,198 @@ void preprocessUiIcons(
     }
 }
 
-dgm::ResourceManager
-ResourceLoader::loadResources(const std::filesystem::path& assetDir)
+AssetArchive ResourceLoader::openArchive(const std::filesystem::path& assetDir)
+{
+    if (auto&& file = MappedFile::open(assetDir / "assets.archive"))
+        return AssetArchive(std::move(*file), assetDir);
+    return AssetArchive();
+}
+
+ResourceCache ResourceLoader::loadResources(
+    const std::filesystem::path& assetDir,
+    const AssetArchive& archive,
+    std::size_t levelAssetBudget,
+    JobSystem& jobs)
 {
     dgm::ResourceManager resmgr;
 
-    if (auto result = resmgr.loadResourcesFromDirectory<sf::Font>(
-            assetDir / "fonts", dgm::Utility::loadFont, { ".ttf" });
+    // Every loader reads from the archive when the file is in it and
+    // falls back to the loose file otherwise. Themes, clips and animations
+    // are never archived, their loaders only accept a path.
+    auto&& fromArchive = [&archive](auto loader)
+    {
+        return [&archive, loader](const std::filesystem::path& path)
+        { return loader(archive, path); };
+    };
+
+    // Lazy types are traced by the cache, eager ones per file here
+    auto&& traced = [](auto loader)
+    {
+        return [loader](const std::filesystem::path& path)
+        {
+            auto&& trace = TraceScope(path.filename().string(), "resource");
+            return loader(path);
+        };
+    };
+
+    if (auto result = Tracer::measure(
+            "fonts",
+            "resources",
+            [&]
+            {
+                return loadResourcesFromDirectory<sf::Font>(
+                    resmgr,
+                    archive,
+                    assetDir,
+                    "fonts",
+                    traced(fromArchive(loadFont)),
+                    { ".ttf" });
+            });
         !result)
     {
         throw std::runtime_error(uni::format(
             "Could not load font: {}", result.error().getMessage()));
     }
 
-    if (auto result = resmgr.loadResourcesFromDirectory<tgui::Font>(
-            assetDir / "fonts", loadTguiFont, { ".ttf" });
+    if (auto result = Tracer::measure(
+            "tgui fonts",
+            "resources",
+            [&]
+            {
+                return loadResourcesFromDirectory<tgui::Font>(
+                    resmgr,
+                    archive,
+                    assetDir,
+                    "fonts",
+                    traced(fromArchive(loadTguiFont)),
+                    { ".ttf" });
+            });
         !result)
     {
         throw std::runtime_error(uni::format(
             "Could not load font: {}", result.error().getMessage()));
     }
 
-    if (auto result = resmgr.loadResourcesFromDirectory<tgui::Theme::Ptr>(
-            assetDir / "ui-themes", loadTguiTheme, { ".txt" });
+    if (auto result = Tracer::measure(
+            "themes",
+            "resources",
+            [&]
+            {
+                return resmgr.loadResourcesFromDirectory<tgui::Theme::Ptr>(
+                    assetDir / "ui-themes", traced(loadTguiTheme), { ".txt" });
+            });
         !result)
     {
         throw std::runtime_error(uni::format(
             "Could not load theme: {}", result.error().getMessage()));
     }
 
-    if (auto result = resmgr.loadResourcesFromDirectory<sf::Texture>(
-            assetDir / "graphics", dgm::Utility::loadTexture, { ".png" });
+    if (auto result = Tracer::measure(
+            "playlists",
+            "resources",
+            [&]
+            {
+                return loadResourcesFromDirectory<Playlist>(
+                    resmgr,
+                    archive,
+                    assetDir,
+                    "music",
+                    traced(fromArchive(loadPlaylist)),
+                    { ".json" });
+            });
         !result)
     {
         throw std::runtime_error(uni::format(
-            "Could not load texture: {}", result.error().getMessage()));
+            "Could not load playlist: {}", result.error().getMessage()));
     }
 
-    if (auto result = resmgr.loadResourcesFromDirectory<tgui::Texture>(
-            assetDir / "graphics", loadTguiTexture, { ".png" });
-        !result)
-    {
-        throw std::runtime_error(uni::format(
-            "Could not load texture: {}", result.error().getMessage()));
-    }
+    // Graphics and sounds are loaded when first needed. Only level-specific
+    // textures are worth evicting, everything else is small or always used.
+    auto&& cache = ResourceCache(std::move(resmgr), levelAssetBudget);
+    cache.registerLazyType<sf::Texture>(
+        assetDir / "graphics",
+        fromArchive(decodeImage),
+        uploadTexture,
+        getTextureByteSize,
+        isLevelSpecific);
+    cache.registerLazyType<tgui::Texture>(
+        assetDir / "graphics",
+        fromArchive(decodeImage),
+        uploadTguiTexture,
+        getTguiTextureByteSize,
+        isLevelSpecific);
+    cache.registerLazyType<dgm::AnimationStates>(
+        assetDir / "graphics",
+        dgm::Utility::loadAnimationStates,
+        [](const dgm::AnimationStates&) { return std::size_t(0); },
+        [](const std::string&) { return false; });
+    cache.registerLazyType<dgm::Clip>(
+        assetDir / "graphics",
+        dgm::Utility::loadClip,
+        [](const dgm::Clip&) { return std::size_t(0); },
+        [](const std::string&) { return false; });
+    cache.registerLazyType<sf::SoundBuffer>(
+        assetDir / "sounds",
+        fromArchive(loadSound),
+        getSoundBufferByteSize,
+        [](const std::string&) { return false; });
 
-    if (auto result = resmgr.loadResourcesFromDirectory<dgm::AnimationStates>(
-            assetDir / "graphics",
-            dgm::Utility::loadAnimationStates,
-            { ".anim" });
-        !result)
-    {
-        throw std::runtime_error(uni::format(
-            "Could not load animation states: {}",
-            result.error().getMessage()));
-    }
+    // What the first frames need is decoded in parallel up front
+    auto&& trace = TraceScope("preload", "resources");
+    cache.preload<sf::Texture>(
+        jobs,
+        { "cursor.png",
+          "pixel-ui-icons.png",
+          "title.png",
+          "background-trees.png" });
+    cache.preload<dgm::Clip>(jobs, { "pixel-ui-icons.png.clip" });
+    preprocessUiIcons("pixel-ui-icons.png", cache);
 
-    if (auto result = resmgr.loadResourcesFromDirectory<dgm::Clip>(
-            assetDir / "graphics", dgm::Utility::loadClip, { ".clip" });
-        !result)
-    {
-        throw std::runtime_error(uni::format(
-            "Could not load clip: {}", result.error().getMessage()));
-    }
+    return cache;
+}
 
-    if (auto result = resmgr.loadResourcesFromDirectory<sf::SoundBuffer>(
-            assetDir / "sounds", dgm::Utility::loadSound, { ".wav" });
-        !result)
-    {
-        throw std::runtime_error(uni::format(
-            "Could not load sound: {}", result.error().getMessage()));
-    }
+LevelPack ResourceLoader::loadLevels(
+    const std::filesystem::path& assetDir,
+    const AssetArchive& archive,
+    JobSystem& jobs)
+{
+    if (auto&& data = archive.find(assetDir / "levels.pack"))
+        return LevelPack(*data);
 
-    if (auto result = resmgr.loadResourcesFromDirectory<tiled::FiniteMapModel>(
-            assetDir / "levels", loadTiledMap, { ".json" });
+    if (auto&& file = MappedFile::open(assetDir / "levels.pack"))
+        return LevelPack(std::move(*file));
+
+    // The pack is produced by the level-pack build target, parsing the
+    // Tiled files is only a fallback for trees where it wasn't built.
+    // The resource manager only lists the files (it can list APK
+    // assets on Android), they are parsed in parallel.
+    dgm::ResourceManager resmgr;
+    if (auto result = resmgr.loadResourcesFromDirectory<std::filesystem::path>(
+            assetDir / "levels", getPath, { ".json" });
         !result)
     {
         throw std::runtime_error(uni::format(
             "Could not load level: {}", result.error().getMessage()));
     }
 
-    if (auto result = resmgr.loadResourcesFromDirectory<Playlist>(
-            assetDir / "music", loadPlaylist, { ".json" });
-        !result)
+    const auto levelIds =
+        resmgr.getLoadedResourceIds<std::filesystem::path>().value();
+    auto&& pending = std::vector<std::future<TiledLevel>>();
+    for (auto&& id : levelIds)
     {
-        throw std::runtime_error(uni::format(
-            "Could not load playlist: {}", result.error().getMessage()));
+        pending.push_back(jobs.submit(
+            [path = resmgr.get<std::filesystem::path>(id)]
+            {
+                return SceneBuilder::convertToTiledLevel(
+                    TiledLoader::loadLevel(path));
+            }));
     }
 
-    preprocessUiIcons("pixel-ui-icons.png", resmgr);
+    auto&& levels = std::vector<std::pair<std::string, TiledLevel>>();
+    for (auto&& idx : std::views::iota(size_t(0), levelIds.size()))
+        levels.emplace_back(levelIds[idx], pending[idx].get());
 
-    return resmgr;
+    return LevelPack(LevelPack::compile(levels));
 }
 
 AppSettings ResourceLoader::loadSettings(const std::filesystem::path& file)
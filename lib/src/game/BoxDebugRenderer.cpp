@@ -0,0 +1,171 @@
+#include "game/BoxDebugRenderer.hpp"
+#include "misc/Compatibility.hpp"
+#include "misc/CoordConverter.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+
+static sf::Color boxToSfColor(b2Color color)
+{
+    return sf::Color(
+        static_cast<uint8_t>(color.r * 255),
+        static_cast<uint8_t>(color.g * 255),
+        static_cast<uint8_t>(color.b * 255),
+        128);
+}
+
+// Unlike sf::FloatRect::findIntersection, this accepts degenerate
+// bounds, such as those of horizontal or vertical segments
+static bool
+overlaps(const sf::FloatRect& area, sf::Vector2f min, sf::Vector2f max)
+{
+    return min.x <= area.position.x + area.size.x && max.x >= area.position.x
+           && min.y <= area.position.y + area.size.y
+           && max.y >= area.position.y;
+}
+
+static const auto UNIT_CIRCLE = []
+{
+    auto&& points =
+        std::array<sf::Vector2f, BoxDebugRenderer::CIRCLE_SEGMENT_COUNT>();
+    for (auto&& idx : std::views::iota(std::size_t(0), points.size()))
+    {
+        const auto angle =
+            2.f * std::numbers::pi_v<float> * idx / points.size();
+        points[idx] = { std::cos(angle), std::sin(angle) };
+    }
+    return points;
+}();
+
+void BoxDebugRenderer::render(b2World& world, sf::RenderTarget& target)
+{
+    // Cameras never rotate, so the view is an axis-aligned rectangle
+    auto&& view = target.getView();
+    begin(
+        sf::FloatRect(view.getCenter() - view.getSize() / 2.f, view.getSize()));
+    world.DebugDraw();
+    flush(target);
+}
+
+void BoxDebugRenderer::begin(const sf::FloatRect& area)
+{
+    visibleArea = area;
+    triangles.clear();
+    lines.clear();
+}
+
+void BoxDebugRenderer::flush(sf::RenderTarget& target) const
+{
+    if (!triangles.empty())
+        target.draw(
+            triangles.data(), triangles.size(), sf::PrimitiveType::Triangles);
+    if (!lines.empty())
+        target.draw(lines.data(), lines.size(), sf::PrimitiveType::Lines);
+}
+
+void BoxDebugRenderer::DrawPolygon(
+    const b2Vec2* vertices, int32 vertexCount, const b2Color& color)
+{
+    if (!isVisible(vertices, vertexCount)) return;
+
+    const auto sfColor = boxToSfColor(color);
+    for (int32 i = 0; i < vertexCount; ++i)
+    {
+        const auto next = vertices[(i + 1) % vertexCount];
+        lines.push_back(
+            { CoordConverter::worldToScreen(vertices[i]), sfColor });
+        lines.push_back({ CoordConverter::worldToScreen(next), sfColor });
+    }
+}
+
+void BoxDebugRenderer::DrawSolidPolygon(
+    const b2Vec2* vertices, int32 vertexCount, const b2Color& color)
+{
+    if (!isVisible(vertices, vertexCount)) return;
+
+    // Box2D polygons are convex, so a fan covers them
+    const auto sfColor = boxToSfColor(color);
+    const auto first = CoordConverter::worldToScreen(vertices[0]);
+    for (int32 i = 1; i + 1 < vertexCount; ++i)
+    {
+        triangles.push_back({ first, sfColor });
+        triangles.push_back(
+            { CoordConverter::worldToScreen(vertices[i]), sfColor });
+        triangles.push_back(
+            { CoordConverter::worldToScreen(vertices[i + 1]), sfColor });
+    }
+}
+
+void BoxDebugRenderer::DrawCircle(
+    const b2Vec2& center, float radius, const b2Color& color)
+{
+    if (!isVisible(center, radius)) return;
+
+    const auto sfColor = boxToSfColor(color);
+    const auto screenCenter = CoordConverter::worldToScreen(center);
+    const auto screenRadius = CoordConverter::worldToScreen(radius);
+    for (auto&& idx : std::views::iota(std::size_t(0), UNIT_CIRCLE.size()))
+    {
+        auto&& next = UNIT_CIRCLE[(idx + 1) % UNIT_CIRCLE.size()];
+        lines.push_back(
+            { screenCenter + UNIT_CIRCLE[idx] * screenRadius, sfColor });
+        lines.push_back({ screenCenter + next * screenRadius, sfColor });
+    }
+}
+
+void BoxDebugRenderer::DrawSolidCircle(
+    const b2Vec2& center, float radius, const b2Vec2&, const b2Color& color)
+{
+    if (!isVisible(center, radius)) return;
+
+    const auto sfColor = boxToSfColor(color);
+    const auto screenCenter = CoordConverter::worldToScreen(center);
+    const auto screenRadius = CoordConverter::worldToScreen(radius);
+    for (auto&& idx : std::views::iota(std::size_t(0), UNIT_CIRCLE.size()))
+    {
+        auto&& next = UNIT_CIRCLE[(idx + 1) % UNIT_CIRCLE.size()];
+        triangles.push_back({ screenCenter, sfColor });
+        triangles.push_back(
+            { screenCenter + UNIT_CIRCLE[idx] * screenRadius, sfColor });
+        triangles.push_back({ screenCenter + next * screenRadius, sfColor });
+    }
+}
+
+void BoxDebugRenderer::DrawSegment(
+    const b2Vec2& p1, const b2Vec2& p2, const b2Color& color)
+{
+    // Chain and edge shapes are drawn as segments
+    const auto points = std::array { p1, p2 };
+    if (!isVisible(points.data(), 2)) return;
+
+    const auto sfColor = boxToSfColor(color);
+    lines.push_back({ CoordConverter::worldToScreen(p1), sfColor });
+    lines.push_back({ CoordConverter::worldToScreen(p2), sfColor });
+}
+
+bool BoxDebugRenderer::isVisible(
+    const b2Vec2* vertices, int32 vertexCount) const noexcept
+{
+    if (vertexCount <= 0) return false;
+
+    auto min = CoordConverter::worldToScreen(vertices[0]);
+    auto max = min;
+    for (int32 i = 1; i < vertexCount; ++i)
+    {
+        const auto point = CoordConverter::worldToScreen(vertices[i]);
+        min = { std::min(min.x, point.x), std::min(min.y, point.y) };
+        max = { std::max(max.x, point.x), std::max(max.y, point.y) };
+    }
+
+    return overlaps(visibleArea, min, max);
+}
+
+bool BoxDebugRenderer::isVisible(
+    const b2Vec2& center, float radius) const noexcept
+{
+    const auto screenCenter = CoordConverter::worldToScreen(center);
+    const auto extent = sf::Vector2f(1.f, 1.f)
+                        * CoordConverter::worldToScreen(radius);
+    return overlaps(visibleArea, screenCenter - extent, screenCenter + extent);
+}
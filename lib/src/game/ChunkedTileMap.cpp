@@ -0,0 +1,143 @@
+#include "game/ChunkedTileMap.hpp"
+#include "misc/Compatibility.hpp"
+#include <algorithm>
+#include <cmath>
+
+static unsigned divideRoundUp(unsigned value, unsigned divisor) noexcept
+{
+    return (value + divisor - 1) / divisor;
+}
+
+static void appendTile(
+    std::vector<sf::Vertex>& vertices,
+    sf::Vector2f position,
+    sf::Vector2f size,
+    const sf::IntRect& frame)
+{
+    const auto texPosition = sf::Vector2f(frame.position);
+    const auto texSize = sf::Vector2f(frame.size);
+
+    auto&& corner = [&](sf::Vector2f offset)
+    {
+        return sf::Vertex {
+            .position = position + offset.componentWiseMul(size),
+            .texCoords = texPosition + offset.componentWiseMul(texSize),
+        };
+    };
+
+    vertices.push_back(corner({ 0.f, 0.f }));
+    vertices.push_back(corner({ 1.f, 0.f }));
+    vertices.push_back(corner({ 0.f, 1.f }));
+    vertices.push_back(corner({ 0.f, 1.f }));
+    vertices.push_back(corner({ 1.f, 0.f }));
+    vertices.push_back(corner({ 1.f, 1.f }));
+}
+
+ChunkedTileMap::ChunkedTileMap(
+    const sf::Texture& texture,
+    const dgm::Clip& clip,
+    sf::Vector2u tileSize,
+    std::span<const int> tiles,
+    sf::Vector2u mapSize)
+    : texture(texture)
+    , chunkSize(sf::Vector2f(tileSize) * float(CHUNK_SIZE_IN_TILES))
+    , chunkCount(
+          divideRoundUp(mapSize.x, CHUNK_SIZE_IN_TILES),
+          divideRoundUp(mapSize.y, CHUNK_SIZE_IN_TILES))
+{
+    const auto useVertexBuffers = sf::VertexBuffer::isAvailable();
+    const auto frameCount = static_cast<int>(clip.getFrameCount());
+
+    chunks.resize(std::size_t(chunkCount.x) * chunkCount.y);
+    auto&& vertices = std::vector<sf::Vertex>();
+    for (auto&& chunkY : std::views::iota(0u, chunkCount.y))
+    {
+        for (auto&& chunkX : std::views::iota(0u, chunkCount.x))
+        {
+            vertices.clear();
+
+            const auto endY =
+                std::min((chunkY + 1) * CHUNK_SIZE_IN_TILES, mapSize.y);
+            const auto endX =
+                std::min((chunkX + 1) * CHUNK_SIZE_IN_TILES, mapSize.x);
+            for (auto y = chunkY * CHUNK_SIZE_IN_TILES; y < endY; ++y)
+            {
+                for (auto x = chunkX * CHUNK_SIZE_IN_TILES; x < endX; ++x)
+                {
+                    const auto tile = tiles[std::size_t(y) * mapSize.x + x];
+                    if (tile < 0 || tile >= frameCount) continue;
+
+                    appendTile(
+                        vertices,
+                        sf::Vector2f(x * tileSize.x, y * tileSize.y),
+                        sf::Vector2f(tileSize),
+                        clip.getFrame(static_cast<unsigned>(tile)));
+                }
+            }
+
+            auto&& chunk = chunks[std::size_t(chunkY) * chunkCount.x + chunkX];
+            if (vertices.empty()) continue;
+
+            if (!useVertexBuffers)
+            {
+                chunk.vertices = vertices;
+                continue;
+            }
+
+            chunk.buffer.setPrimitiveType(sf::PrimitiveType::Triangles);
+            chunk.buffer.setUsage(sf::VertexBuffer::Usage::Static);
+            if (!chunk.buffer.create(vertices.size())
+                || !chunk.buffer.update(vertices.data()))
+                chunk.vertices = vertices;
+        }
+    }
+}
+
+ChunkedTileMap::ChunkRange ChunkedTileMap::getVisibleChunks(
+    const sf::FloatRect& area,
+    sf::Vector2f chunkSize,
+    sf::Vector2u chunkCount) noexcept
+{
+    auto&& clampToMap = [](float chunkIdx, unsigned count)
+    {
+        return static_cast<unsigned>(
+            std::clamp(chunkIdx, 0.f, static_cast<float>(count)));
+    };
+
+    const auto begin = area.position.componentWiseDiv(chunkSize);
+    const auto end = (area.position + area.size).componentWiseDiv(chunkSize);
+    return ChunkRange {
+        .begin = { clampToMap(std::floor(begin.x), chunkCount.x),
+                   clampToMap(std::floor(begin.y), chunkCount.y) },
+        .end = { clampToMap(std::ceil(end.x), chunkCount.x),
+                 clampToMap(std::ceil(end.y), chunkCount.y) },
+    };
+}
+
+void ChunkedTileMap::draw(
+    sf::RenderTarget& target, sf::RenderStates states) const
+{
+    // Cameras never rotate, so the view is an axis-aligned rectangle
+    auto&& view = target.getView();
+    const auto range = getVisibleChunks(
+        sf::FloatRect(view.getCenter() - view.getSize() / 2.f, view.getSize()),
+        chunkSize,
+        chunkCount);
+
+    states.texture = &texture;
+    for (auto y = range.begin.y; y < range.end.y; ++y)
+    {
+        for (auto x = range.begin.x; x < range.end.x; ++x)
+        {
+            auto&& chunk = chunks[std::size_t(y) * chunkCount.x + x];
+            if (!chunk.vertices.empty())
+                target.draw(
+                    chunk.vertices.data(),
+                    chunk.vertices.size(),
+                    sf::PrimitiveType::Triangles,
+                    states);
+            else if (chunk.buffer.getVertexCount() > 0)
+                target.draw(chunk.buffer, states);
+        }
+    }
+}
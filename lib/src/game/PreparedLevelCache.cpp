@@ -0,0 +1,59 @@
+#include "game/PreparedLevelCache.hpp"
+#include "game/SceneBuilder.hpp"
+
+static std::shared_ptr<const PreparedLevel>
+prepare(const LevelPack& pack, const std::string& levelId)
+{
+    return std::make_shared<const PreparedLevel>(
+        SceneBuilder::prepareLevel(pack.getLevel(levelId)));
+}
+
+void PreparedLevelCache::prepareAllInBackground()
+{
+    if (worker.joinable()) return;
+
+    // The pack is immutable, so the worker can read it without locking
+    worker = std::jthread(
+        [this](std::stop_token stopToken)
+        {
+            for (auto&& id : pack.getLevelIds())
+            {
+                if (stopToken.stop_requested()) return;
+                if (find(id)) continue;
+
+                try
+                {
+                    insert(id, prepare(pack, id));
+                }
+                catch (...)
+                {
+                    // Leave it to get() to report the error when
+                    // the level is actually played
+                }
+            }
+        });
+}
+
+std::shared_ptr<const PreparedLevel>
+PreparedLevelCache::get(const std::string& levelId)
+{
+    if (auto&& level = find(levelId)) return level;
+    return insert(levelId, prepare(pack, levelId));
+}
+
+std::shared_ptr<const PreparedLevel>
+PreparedLevelCache::find(const std::string& levelId) const
+{
+    auto&& lock = std::scoped_lock(mutex);
+    auto&& itr = levels.find(levelId);
+    return itr == levels.end() ? nullptr : itr->second;
+}
+
+std::shared_ptr<const PreparedLevel> PreparedLevelCache::insert(
+    const std::string& levelId, std::shared_ptr<const PreparedLevel> level)
+{
+    auto&& lock = std::scoped_lock(mutex);
+    // Whoever came first wins, both results are equal anyway
+    auto&& [itr, inserted] = levels.try_emplace(levelId, std::move(level));
+    return itr->second;
+}
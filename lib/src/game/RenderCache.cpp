@@ -0,0 +1,75 @@
+#include "game/RenderCache.hpp"
+#include "misc/Compatibility.hpp"
+
+static auto setAndGetSpritesheet(
+    dgm::TextureAtlas& atlas,
+    const sf::Texture& texture,
+    const dgm::AnimationStates& states)
+{
+    auto locator = atlas.addSpritesheet(texture, states);
+    return atlas.getAnimationStates(locator.value());
+}
+
+static auto setAndGetTileset(
+    dgm::TextureAtlas& atlas, const sf::Texture& texture, const dgm::Clip& clip)
+{
+    auto locator = atlas.addTileset(texture, clip);
+    return atlas.getClip(locator.value());
+}
+
+AtlasRenderData::AtlasRenderData(
+    const ResourceCache& resmgr, const std::string& tilesetName)
+    : atlas(1024, 1024)
+    , ballAnimationStates(setAndGetSpritesheet(
+          atlas,
+          resmgr.get<sf::Texture>("ball.png"),
+          resmgr.get<dgm::AnimationStates>("ball.png.anim")))
+    , magnetLineAnimationStates(setAndGetSpritesheet(
+          atlas,
+          resmgr.get<sf::Texture>("lines.png"),
+          resmgr.get<dgm::AnimationStates>("lines.png.anim")))
+    , tileset(setAndGetTileset(
+          atlas,
+          resmgr.get<sf::Texture>(tilesetName),
+          resmgr.get<dgm::Clip>(tilesetName + ".clip")))
+{
+}
+
+AtlasRenderData& RenderCache::getAtlas(const std::string& tilesetName)
+{
+    if (atlas && atlasTilesetName == tilesetName) return *atlas;
+
+    // The tile map draws from the atlas texture, so it goes first
+    tileMap.reset();
+    tileMapKey.clear();
+    atlas.reset();
+    atlas = std::make_unique<AtlasRenderData>(resmgr, tilesetName);
+    atlasTilesetName = tilesetName;
+    return *atlas;
+}
+
+ChunkedTileMap&
+RenderCache::getTileMap(const GameConfig& config, const TiledLevel& level)
+{
+    // Skin is not part of the key, all skins live in the same spritesheet
+    auto&& key =
+        uni::format("{}/{}", config.tilesetName, config.levelResourceName);
+    if (tileMap && tileMapKey == key) return *tileMap;
+
+    auto&& atlasData = getAtlas(config.tilesetName);
+    const auto tiles = level.tileLayers.front().tiles
+                       | std::views::transform(
+                           [](Tile tile)
+                           { return int(std::to_underlying(tile)) - 1; })
+                       | uniranges::to<std::vector>();
+    tileMap.reset();
+    tileMap = std::make_unique<ChunkedTileMap>(
+        atlasData.atlas.getTexture(),
+        atlasData.tileset,
+        sf::Vector2u(level.tileWidth, level.tileHeight),
+        tiles,
+        sf::Vector2u(level.width, level.height));
+    tileMapKey = std::move(key);
+
+    return *tileMap;
+}
@@ -0,0 +1,42 @@
+#include "game/ResolutionGovernor.hpp"
+#include <algorithm>
+
+// With vsync, frames within budget take the target time plus jitter
+constexpr float WITHIN_BUDGET_FACTOR = 1.05f;
+constexpr float OVER_BUDGET_FACTOR = 1.2f;
+
+bool ResolutionGovernor::update(float frameTime) noexcept
+{
+    windowTime += frameTime;
+    if (++windowFrames < WINDOW_FRAME_COUNT) return false;
+
+    const auto average = windowTime / static_cast<float>(windowFrames);
+    windowTime = 0.f;
+    windowFrames = 0;
+
+    if (average > targetFrameTime * OVER_BUDGET_FACTOR)
+    {
+        windowsWithinBudget = 0;
+        if (scale == 1) return false;
+
+        if (lastChangeWasRaise)
+            windowsToRaise = std::min(windowsToRaise * 2, MAX_WINDOWS_TO_RAISE);
+        lastChangeWasRaise = false;
+        --scale;
+        return true;
+    }
+
+    if (average > targetFrameTime * WITHIN_BUDGET_FACTOR)
+    {
+        windowsWithinBudget = 0;
+        return false;
+    }
+
+    if (++windowsWithinBudget < windowsToRaise || scale == maxScale)
+        return false;
+
+    windowsWithinBudget = 0;
+    lastChangeWasRaise = true;
+    ++scale;
+    return true;
+}
@@ -0,0 +1,43 @@
+#include "game/SpriteBatch.hpp"
+#include <cmath>
+
+void SpriteBatch::add(const sf::Sprite& sprite)
+{
+    const auto rect = sf::FloatRect(sprite.getTextureRect());
+    const auto size =
+        sf::Vector2f(std::abs(rect.size.x), std::abs(rect.size.y));
+    const auto& transform = sprite.getTransform();
+    const auto color = sprite.getColor();
+
+    auto&& corner = [&](sf::Vector2f localPos, sf::Vector2f texCoords)
+    {
+        return sf::Vertex {
+            .position = transform.transformPoint(localPos),
+            .color = color,
+            .texCoords = texCoords,
+        };
+    };
+
+    // Negative texture rect size flips the sprite, same as sf::Sprite
+    const auto topLeft = corner({ 0.f, 0.f }, rect.position);
+    const auto topRight = corner(
+        { size.x, 0.f }, { rect.position.x + rect.size.x, rect.position.y });
+    const auto bottomLeft = corner(
+        { 0.f, size.y }, { rect.position.x, rect.position.y + rect.size.y });
+    const auto bottomRight = corner(size, rect.position + rect.size);
+
+    vertices.append(topLeft);
+    vertices.append(topRight);
+    vertices.append(bottomLeft);
+    vertices.append(bottomLeft);
+    vertices.append(topRight);
+    vertices.append(bottomRight);
+}
+
+void SpriteBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+    if (vertices.getVertexCount() == 0) return;
+
+    states.texture = &texture;
+    target.draw(vertices, states);
+}
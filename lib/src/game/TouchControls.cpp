@@ -14,7 +14,7 @@ createMagnetButton(const sf::Vector2u& windowSize, bool left, float scaleFactor)
 }
 
 TouchControls::TouchControls(
-    const dgm::ResourceManager& resmgr,
+    const ResourceCache& resmgr,
     Input& input,
     const InputSettings& settings,
     const sf::Vector2u& windowSize)
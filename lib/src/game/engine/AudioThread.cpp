@@ -0,0 +1,70 @@
+#include "game/engine/AudioThread.hpp"
+#include "misc/Tracer.hpp"
+#include "types/Overloads.hpp"
+
+AudioThread::AudioThread(
+    const ResourceCache& resmgr, const AudioSettings& settings)
+    : settings(settings)
+    , sentSoundVolume(settings.soundVolume)
+    , engine(resmgr, settings.soundVolume)
+    , thread([this](std::stop_token stopToken) { run(stopToken); })
+{
+}
+
+void AudioThread::endFrame()
+{
+    // Volume can be changed from the pause menu
+    if (settings.soundVolume != sentSoundVolume)
+    {
+        sentSoundVolume = settings.soundVolume;
+        send(SetSoundVolumeCommand { sentSoundVolume });
+    }
+
+    send(EndFrameCommand {});
+    wakeUp();
+}
+
+void AudioThread::stopLoops()
+{
+    send(StopLoopsCommand {});
+    wakeUp();
+}
+
+void AudioThread::send(AudioCommand&& command)
+{
+    if (channel.tryPush(std::move(command))) return;
+
+    const auto now = Tracer::Clock::now();
+    Tracer::record("dropped audio command", "audio", now, now);
+}
+
+void AudioThread::wakeUp()
+{
+    // Taking the mutex orders the push before the audio thread's check,
+    // so the notification can't slip in between the check and the sleep
+    {
+        auto&& lock = std::scoped_lock(wakeUpMutex);
+    }
+    commandsSent.notify_one();
+}
+
+void AudioThread::run(std::stop_token stopToken)
+{
+    auto&& execute = overloads {
+        [&](const AudioEvent& event) { std::visit(engine, event); },
+        [&](EndFrameCommand) { engine.update(); },
+        [&](StopLoopsCommand) { engine.stopLoops(); },
+        [&](SetSoundVolumeCommand command)
+        { engine.setSoundVolume(command.volume); },
+    };
+
+    while (!stopToken.stop_requested())
+    {
+        channel.drain(
+            [&](AudioCommand&& command) { std::visit(execute, command); });
+
+        auto&& lock = std::unique_lock(wakeUpMutex);
+        commandsSent.wait(
+            lock, stopToken, [&] { return !channel.isEmpty(); });
+    }
+}
@@ -5,6 +5,35 @@
 #include "misc/CoordConverter.hpp"
 #include "misc/Utility.hpp"
 #include "types/SemanticTypes.hpp"
+#include <algorithm>
+#include <cmath>
+
+static sf::Text createText(const sf::Font& font, unsigned characterSize)
+{
+    auto&& text = sf::Text(font, "", characterSize);
+    text.setOutlineColor(COLOR_BLACK);
+    text.setOutlineThickness(0.5f);
+    text.setFillColor(COLOR_WHITE);
+    text.setLineSpacing(1.1f);
+    return text;
+}
+
+static unsigned computeMaxRenderScale(const sf::Vector2f& windowSize)
+{
+    // Rendering above the window resolution would only waste fill rate
+    const auto scale = windowSize.componentWiseDiv(INTERNAL_RESOLUTION);
+    return std::clamp(
+        static_cast<unsigned>(std::floor(std::min(scale.x, scale.y))),
+        1u,
+        MAX_RENDER_SCALE);
+}
+
+static sf::View withFullViewport(const dgm::Camera& camera)
+{
+    auto view = camera.getCurrentView();
+    view.setViewport(sf::FloatRect { { 0.f, 0.f }, { 1.f, 1.f } });
+    return view;
+}
 
 static dgm::Camera createFullscreenCamera(
     const sf::Vector2f& currentResolution,
@@ -36,51 +65,26 @@ static dgm::Camera createFullscreenCamera(
     return dgm::Camera(viewport, sf::Vector2f(desiredResolution));
 }
 
-static auto setAndGetSpritesheet(
-    dgm::TextureAtlas& atlas,
-    const sf::Texture& texture,
-    const dgm::AnimationStates& states)
-{
-    auto locator = atlas.addSpritesheet(texture, states);
-    return atlas.getAnimationStates(locator.value());
-}
-
-static auto setAndGetTileset(
-    dgm::TextureAtlas& atlas, const sf::Texture& texture, const dgm::Clip& clip)
-{
-    auto locator = atlas.addTileset(texture, clip);
-    return atlas.getClip(locator.value());
-}
-
 RenderingEngine::RenderingEngine(
     dgm::Window& window,
-    dgm::ResourceManager& resmgr,
+    ResourceCache& resmgr,
     const VideoSettings& settings,
     const StringProvider& strings,
     Scene& scene,
     const TiledLevel& level,
-    const GameConfig& config) noexcept
+    const GameConfig& config,
+    RenderCache& renderCache,
+    FrameProfiler& profiler)
     // Dependencies
     : window(window)
     , settings(settings)
     , strings(strings)
     , scene(scene)
-    // Atlas properties
-    , atlas(1024, 1024)
-    , ballAnimationStates(setAndGetSpritesheet(
-          atlas,
-          resmgr.get<sf::Texture>("ball.png"),
-          resmgr.get<dgm::AnimationStates>("ball.png.anim")))
-    , magnetLineAnimationStates(setAndGetSpritesheet(
-          atlas,
-          resmgr.get<sf::Texture>("lines.png"),
-          resmgr.get<dgm::AnimationStates>("lines.png.anim")))
-    , tileset(setAndGetTileset(
-          atlas,
-          resmgr.get<sf::Texture>(config.tilesetName),
-          resmgr.get<dgm::Clip>(config.tilesetName + ".clip")))
+    // Cached between attempts
+    , atlasData(renderCache.getAtlas(config.tilesetName))
+    , tileMap(renderCache.getTileMap(config, level))
+    , profiler(profiler)
     // Non-drawables
-    , boxDebugRenderer(window)
     , backgroundCamera(createFullscreenCamera(
           sf::Vector2f(window.getSize()), INTERNAL_RESOLUTION))
     , worldCamera(createFullscreenCamera(
@@ -88,57 +92,68 @@ RenderingEngine::RenderingEngine(
     , hudCamera(
           sf::FloatRect { { 0.f, 0.f }, { 1.f, 1.f } },
           sf::Vector2f(window.getSize()))
+    , resolutionGovernor(
+          computeMaxRenderScale(sf::Vector2f(window.getSize())),
+          TARGET_FRAME_TIME)
     , animation(2, 10)
     , joeSkinName(config.joeSkinName)
 
     // Drawables
-    , text(resmgr.get<sf::Font>("pico-8.ttf"))
-    , tileMap(dgm::TileMap(atlas.getTexture(), tileset))
-    , sprite(atlas.getTexture())
-    , line(atlas.getTexture())
+    , timerText(createText(resmgr.get<sf::Font>("pico-8.ttf"), 0))
+    , timerString("00:00.00")
+    , promptText(createText(resmgr.get<sf::Font>("pico-8.ttf"), 0))
+    , profilerText(createText(resmgr.get<sf::Font>("pico-8.ttf"), 0))
+    , sprite(atlasData.atlas.getTexture())
+    , line(atlasData.atlas.getTexture())
+    , worldBatch(atlasData.atlas.getTexture())
     , background(resmgr.get<sf::Texture>(config.backgroundName))
-    , joeAnimation(ballAnimationStates, 15)
+    , worldSprite(worldTexture.getTexture())
+    , joeAnimation(atlasData.ballAnimationStates, 15)
 {
-    tileMap.build(
-        { level.tileWidth, level.tileHeight },
-        level.tileLayers.front().tiles
-            | std::views::transform([](Tile tile)
-                                    { return std::to_underlying(tile) - 1; })
-            | uniranges::to<std::vector>(),
-        { level.width, level.height });
-
     setJoeIdleState();
 
     sprite.setOrigin(sf::Vector2f {
-        ballAnimationStates.begin()->second.getFrameSize() / 2u });
+        atlasData.ballAnimationStates.begin()->second.getFrameSize() / 2u });
     spriteOutline.setRadius(sprite.getOrigin().x);
     spriteOutline.setOrigin(sprite.getOrigin());
     spriteOutline.setOutlineThickness(3.f);
     spriteOutline.setFillColor(sf::Color::Transparent);
     scene.world->SetDebugDraw(&boxDebugRenderer);
-    boxDebugRenderer.SetFlags(b2Draw::e_shapeBit);
 
     line.setOrigin({ 0.f, 12.f });
 
-    text.setOutlineColor(COLOR_BLACK);
-    text.setOutlineThickness(0.5f);
-    text.setFillColor(COLOR_WHITE);
-    text.setLineSpacing(1.1f);
-
     resmgr.getMutable<sf::Font>("pico-8.ttf").setSmooth(false);
+
+    labelTexts.reserve(scene.texts.size());
+    for (auto&& label : scene.texts)
+    {
+        auto&& labelText =
+            labelTexts.emplace_back(createText(timerText.getFont(), 10));
+        labelText.setString(strings.getString(label.textId));
+        labelText.setPosition(label.position);
+    }
+
+#ifdef ANDROID
+    promptText.setString(strings.getString(StringId::TouchToStart));
+#else
+    promptText.setString(strings.getString(StringId::SpaceToStart));
+#endif
+
+    setupHudTexts();
 }
 
 void RenderingEngine::update(const dgm::Time& time)
 {
     animation.update(time);
 
+    if (settings.dynamicResolution)
+        resolutionGovernor.update(time.getDeltaTime());
+
     if (joeAnimation.update(time) == dgm::Animation::PlaybackStatus::Finished)
     {
         setJoeIdleState();
     }
 
-    fpsCounter.update(time.getDeltaTime());
-
     timeToBlink -= time.getElapsed();
     if (timeToBlink < sf::Time::Zero)
     {
@@ -156,25 +171,72 @@ static sf::Vector2f operator-(const sf::Vector2f& a, const b2Vec2& b)
 
 void RenderingEngine::draw(bool paused)
 {
-    window.setViewFromCamera(backgroundCamera);
-    window.draw(background);
+    profiler.measure(
+        FramePhase::RenderWorld,
+        [&]
+        {
+            if (settings.dynamicResolution && renderWorldScaled()) return;
+
+            auto&& target = window.getSfmlWindowContext();
+            window.setViewFromCamera(backgroundCamera);
+            window.draw(background);
 
-    window.setViewFromCamera(worldCamera);
-    renderWorld();
+            window.setViewFromCamera(worldCamera);
+            renderWorld(target);
+        });
 
     window.setViewFromCamera(hudCamera);
 
-    if (!paused) renderHUD();
+    if (!paused) profiler.measure(FramePhase::Hud, [&] { renderHUD(); });
+}
+
+bool RenderingEngine::renderWorldScaled()
+{
+    const auto scale = static_cast<float>(resolutionGovernor.getScale());
+    const auto size = sf::Vector2u(INTERNAL_RESOLUTION * scale);
+    if (worldTexture.getSize() != size)
+    {
+        if (!worldTexture.resize(size)) return false;
+        // Pixel art is upscaled by a whole multiple most of the time
+        worldTexture.setSmooth(false);
+        worldSprite.setTextureRect(
+            sf::IntRect { { 0, 0 }, sf::Vector2i(size) });
+    }
+
+    // The letterbox is applied once, when the texture is drawn
+    worldTexture.setView(withFullViewport(backgroundCamera));
+    worldTexture.draw(background);
+    worldTexture.setView(withFullViewport(worldCamera));
+    renderWorld(worldTexture);
+    worldTexture.display();
+
+    const auto windowSize = sf::Vector2f(window.getSize());
+    const auto viewport = worldCamera.getCurrentView().getViewport();
+    worldSprite.setPosition(viewport.position.componentWiseMul(windowSize));
+    worldSprite.setScale(viewport.size.componentWiseMul(windowSize)
+                             .componentWiseDiv(sf::Vector2f(size)));
+
+    window.setViewFromCamera(hudCamera);
+    window.draw(worldSprite);
+    return true;
 }
 
-void RenderingEngine::renderWorld()
+void RenderingEngine::renderWorld(sf::RenderTarget& target)
 {
-    auto joePos = CoordConverter::worldToScreen(scene.joe.GetPosition());
+    // Render Joe in between the last two simulation ticks so the motion
+    // stays smooth when the frame rate differs from the tick rate
+    const auto joeWorldPos = scene.joePreviousPosition
+                             + scene.interpolation
+                                   * (scene.joe.GetPosition()
+                                      - scene.joePreviousPosition);
+    const auto joeAngle = std::lerp(
+        scene.joePreviousAngle, scene.joe.GetAngle(), scene.interpolation);
+    auto joePos = CoordConverter::worldToScreen(joeWorldPos);
 
     worldCamera.setPosition(joePos);
     sprite.setTextureRect(joeAnimation.getCurrentFrame());
     sprite.setPosition(joePos);
-    sprite.setRotation(sf::radians(scene.joe.GetAngle()));
+    sprite.setRotation(sf::radians(joeAngle));
     spriteOutline.setPosition(joePos);
 
     if (scene.magnetPolarity == MAGNET_POLARITY_NONE)
@@ -184,31 +246,39 @@ void RenderingEngine::renderWorld()
     else if (scene.magnetPolarity == MAGNET_POLARITY_BLUE)
         spriteOutline.setOutlineColor(sf::Color::Blue);
 
-    window.draw(tileMap);
-    window.draw(spriteOutline);
-    window.draw(sprite);
+    worldBatch.clear();
+    worldBatch.add(sprite);
 
     if (scene.magnetPolarity != 0)
     {
-        for (auto&& magnet : scene.magnets)
-        {
-            const auto direction = magnet.position - scene.joe.GetPosition();
-            if (direction.length() < MAGNET_RANGE)
+        scene.magnets.forEachNear(
+            sf::Vector2f(joeWorldPos.x, joeWorldPos.y),
+            [&](const Magnet& magnet)
             {
-                renderMagnetLine(joePos, direction);
-            }
-        }
+                const auto direction = magnet.position - joeWorldPos;
+                if (direction.length() < MAGNET_RANGE)
+                {
+                    renderMagnetLine(joePos, direction);
+                }
+            });
     }
 
-    if (settings.renderColliders) scene.world->DebugDraw();
+    target.draw(tileMap);
+    // The outline is untextured, so it can't be part of the batch
+    if (scene.magnetPolarity != MAGNET_POLARITY_NONE)
+        target.draw(spriteOutline);
+    target.draw(worldBatch);
 
-    for (auto&& label : scene.texts)
+    if (settings.renderColliders)
     {
-        text.setCharacterSize(10);
-        text.setString(strings.getString(label.textId));
-        text.setPosition(label.position);
-        window.draw(text);
+        boxDebugRenderer.SetFlags(
+            b2Draw::e_shapeBit
+            | (settings.renderColliderBounds ? b2Draw::e_aabbBit : 0u));
+        boxDebugRenderer.render(*scene.world, target);
     }
+
+    for (auto&& labelText : labelTexts)
+        target.draw(labelText);
 }
 
 void RenderingEngine::renderMagnetLine(
@@ -226,49 +296,102 @@ void RenderingEngine::renderMagnetLine(
               / MAGLINE_SCREEN_LENGTH,
           1.f });
     line.setTextureRect(
-        magnetLineAnimationStates
+        atlasData.magnetLineAnimationStates
             [scene.magnetPolarity == MAGNET_POLARITY_RED ? "red" : "blue"]
                 .getFrame(animation.getFrame()));
-    window.draw(line);
+    worldBatch.add(line);
 }
 
 void RenderingEngine::renderHUD()
 {
-    const auto baseFontSize = Sizers::getBaseFontSize();
-    text.setCharacterSize(baseFontSize);
+    // UI scale can be changed from the pause menu
+    if (timerText.getCharacterSize() != Sizers::getBaseFontSize())
+        setupHudTexts();
 
-    if (settings.showFps)
-    {
-        text.setString(fpsCounter.getText());
-        text.setPosition({
-            static_cast<float>(window.getSize().x)
-                - text.getGlobalBounds().size.x - 10.f,
-            20.f + baseFontSize,
-        });
-        window.draw(text);
-    }
+    if (settings.showFps) renderProfilerStats();
 
-    text.setString(Utility::formatTime(scene.timer));
-    text.setPosition({
-        window.getSize().x / 2.f - text.getGlobalBounds().size.x / 2.f,
+    updateTimerText();
+    window.draw(timerText);
+
+    if (!scene.playing) window.draw(promptText);
+}
+
+void RenderingEngine::setupHudTexts()
+{
+    const auto baseFontSize = Sizers::getBaseFontSize();
+    timerText.setCharacterSize(baseFontSize);
+    profilerText.setCharacterSize(baseFontSize / 2);
+    promptText.setCharacterSize(baseFontSize * 2);
+    promptText.setPosition(
+        sf::Vector2f(window.getSize()) / 2.f
+        - promptText.getGlobalBounds().size / 2.f);
+
+    displayedCentiseconds.reset();
+    framesUntilProfilerRefresh = 0;
+    updateTimerText();
+}
+
+void RenderingEngine::updateTimerText()
+{
+    const auto time = scene.timer * SIMULATION_TIMESTEP;
+    const auto centiseconds = static_cast<unsigned>(time * 100.f);
+    if (centiseconds == displayedCentiseconds) return;
+    displayedCentiseconds = centiseconds;
+
+    auto&& buffer = std::array<char, 16>();
+    const auto formatted = Utility::formatTime(time, buffer);
+
+    // Characters are overwritten in place so the string, and the copy
+    // sf::Text keeps of it, reuse their storage
+    if (timerString.getSize() != formatted.size())
+        timerString = std::string(formatted);
+    for (auto&& idx : std::views::iota(std::size_t(0), formatted.size()))
+        timerString[idx] = static_cast<char32_t>(formatted[idx]);
+
+    timerText.setString(timerString);
+    timerText.setPosition({
+        window.getSize().x / 2.f - timerText.getGlobalBounds().size.x / 2.f,
         10.f,
     });
-    window.draw(text);
+}
 
-    if (!scene.playing)
+void RenderingEngine::renderProfilerStats()
+{
+    const unsigned REFRESH_INTERVAL_FRAMES = 30;
+
+    if (framesUntilProfilerRefresh-- == 0)
     {
-        text.setCharacterSize(baseFontSize * 2);
+        framesUntilProfilerRefresh = REFRESH_INTERVAL_FRAMES;
+        auto&& lines = uni::format(
+            "{:<8}{:>6}{:>6}{:>6}{:>6}",
+            "ms",
+            "min",
+            "avg",
+            "p95",
+            "p99");
+        for (auto&& idx :
+             std::views::iota(std::size_t(0), FrameProfiler::PHASE_COUNT))
+        {
+            const auto stats =
+                profiler.computeStats(static_cast<FramePhase>(idx));
+            lines += uni::format(
+                "\n{:<8}{:>6.2f}{:>6.2f}{:>6.2f}{:>6.2f}",
+                FrameProfiler::PHASE_NAMES[idx],
+                stats.min,
+                stats.avg,
+                stats.p95,
+                stats.p99);
+        }
 
-#ifdef ANDROID
-        text.setString(strings.getString(StringId::TouchToStart));
-#else
-        text.setString(strings.getString(StringId::SpaceToStart));
-#endif
-        text.setPosition(
-            sf::Vector2f(window.getSize()) / 2.f
-            - text.getGlobalBounds().size / 2.f);
-        window.draw(text);
+        profilerText.setString(lines);
+        profilerText.setPosition({
+            static_cast<float>(window.getSize().x)
+                - profilerText.getGlobalBounds().size.x - 10.f,
+            20.f + Sizers::getBaseFontSize(),
+        });
     }
+
+    window.draw(profilerText);
 }
 
 void RenderingEngine::setJoeIdleState()
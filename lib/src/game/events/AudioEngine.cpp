@@ -1,13 +1,101 @@
 #include "game/engine/AudioEngine.hpp"
-#include <SFML/Audio/SoundBuffer.hpp>
+#include "game/SimulationConstants.hpp"
+#include <algorithm>
 
-void AudioEngine::playSound(const std::string& name, bool override)
+// The buzz is at full volume when two magnets pull together
+constexpr float BUZZ_FULL_GAIN_FORCE = 2.f * MAGNET_FORCE;
+constexpr float BUZZ_MIN_GAIN = 0.25f;
+
+AudioEngine::AudioEngine(const ResourceCache& resmgr, float soundVolume)
+    : soundVolume(soundVolume)
+    , buzzRed(resmgr.get<sf::SoundBuffer>("buzzRed.wav"))
+    , buzzBlue(resmgr.get<sf::SoundBuffer>("buzzBlue.wav"))
+    , winFanfare(resmgr.get<sf::SoundBuffer>("win_fanfare.wav"))
+    , loseFanfare(resmgr.get<sf::SoundBuffer>("lose_fanfare.wav"))
+    , allocator(VOICE_COUNT)
+{
+    voices.reserve(VOICE_COUNT);
+    for (std::size_t idx = 0; idx < VOICE_COUNT; ++idx)
+        voices.emplace_back(buzzRed);
+}
+
+void AudioEngine::update()
+{
+    // Fanfares end the level, the buzz should not play over them
+    if (pending.won)
+        playOnce(winFanfare, SoundPriority::Fanfare);
+    else if (pending.died)
+        playOnce(loseFanfare, SoundPriority::Fanfare);
+
+    if (pending.buzz && !pending.won && !pending.died)
+        updateBuzz(*pending.buzz, pending.buzzForce);
+    else
+        stopLoops();
+
+    pending = {};
+}
+
+void AudioEngine::stopLoops()
+{
+    if (!buzzVoice) return;
+    voices[*buzzVoice].stop();
+    buzzVoice.reset();
+}
+
+void AudioEngine::requestBuzz(
+    const sf::SoundBuffer& buffer, float force) noexcept
+{
+    pending.buzz = &buffer;
+    pending.buzzForce = std::max(pending.buzzForce, force);
+}
+
+void AudioEngine::updateBuzz(const sf::SoundBuffer& buffer, float force)
+{
+    if (!buzzVoice)
+    {
+        buzzVoice = acquireVoice(SoundPriority::Buzz);
+        if (!buzzVoice) return;
+    }
+
+    auto&& voice = voices[*buzzVoice];
+    if (&voice.getBuffer() != &buffer
+        || voice.getStatus() != sf::SoundSource::Status::Playing)
+    {
+        voice.setBuffer(buffer);
+        voice.setLooping(true);
+        voice.play();
+    }
+
+    const auto gain =
+        std::clamp(force / BUZZ_FULL_GAIN_FORCE, BUZZ_MIN_GAIN, 1.f);
+    voice.setVolume(soundVolume * gain);
+}
+
+void AudioEngine::playOnce(
+    const sf::SoundBuffer& buffer, SoundPriority priority)
+{
+    const auto idx = acquireVoice(priority);
+    if (!idx) return;
+
+    auto&& voice = voices[*idx];
+    voice.setBuffer(buffer);
+    voice.setLooping(false);
+    voice.setVolume(soundVolume);
+    voice.play();
+}
+
+std::optional<std::size_t> AudioEngine::acquireVoice(SoundPriority priority)
 {
-    if (channel && channel->getStatus() == sf::SoundSource::Status::Playing
-        && !override)
-        return;
+    const auto idx = allocator.acquire(
+        priority,
+        [&](std::size_t voiceIdx)
+        {
+            return voices[voiceIdx].getStatus()
+                   == sf::SoundSource::Status::Playing;
+        });
 
-    channel = sf::Sound(resmgr.get<sf::SoundBuffer>(name));
-    channel->setVolume(settings.soundVolume);
-    channel->play();
+    // The buzz has the lowest priority, so it is the first to be stolen
+    if (idx && idx == buzzVoice) buzzVoice.reset();
+    if (idx) voices[*idx].stop();
+    return idx;
 }
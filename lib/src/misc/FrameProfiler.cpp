@@ -0,0 +1,66 @@
+#include "misc/FrameProfiler.hpp"
+#include "misc/Compatibility.hpp"
+#include <algorithm>
+#include <cmath>
+
+void FrameProfiler::beginFrame() noexcept
+{
+    currentFrame = (currentFrame + 1) % CAPACITY;
+    samples[currentFrame].fill(0.f);
+    frameCount = std::min(frameCount + 1, CAPACITY);
+}
+
+FrameProfiler::PhaseStats
+FrameProfiler::computeStats(FramePhase phase) const noexcept
+{
+    // The current frame is still being recorded, later phases are zero
+    if (frameCount <= 1) return {};
+    const auto completedCount = frameCount - 1;
+
+    // Sorted on the stack, the overlay asks for stats while playing
+    auto&& sorted = std::array<float, CAPACITY>();
+    auto&& sum = 0.f;
+    auto&& count = std::size_t(0);
+    for (auto&& idx : std::views::iota(std::size_t(0), frameCount))
+    {
+        if (idx == currentFrame) continue;
+        sorted[count] = samples[idx][static_cast<std::size_t>(phase)];
+        sum += sorted[count];
+        ++count;
+    }
+    std::sort(sorted.begin(), sorted.begin() + completedCount);
+
+    // Nearest-rank percentile
+    auto&& percentile = [&](float p)
+    {
+        const auto rank = static_cast<std::size_t>(
+            std::ceil(p * static_cast<float>(completedCount)));
+        return sorted[std::max(rank, std::size_t(1)) - 1];
+    };
+
+    return PhaseStats {
+        .min = sorted[0],
+        .avg = sum / static_cast<float>(completedCount),
+        .p95 = percentile(0.95f),
+        .p99 = percentile(0.99f),
+    };
+}
+
+std::string FrameProfiler::exportCsv() const
+{
+    auto&& result = std::string("frame");
+    for (auto&& name : PHASE_NAMES)
+        result += uni::format(",{}", name);
+    result += '\n';
+
+    const auto oldest = (currentFrame + CAPACITY + 1 - frameCount) % CAPACITY;
+    for (auto&& idx : std::views::iota(std::size_t(0), frameCount))
+    {
+        result += std::to_string(idx);
+        for (auto&& time : samples[(oldest + idx) % CAPACITY])
+            result += uni::format(",{:.3f}", time);
+        result += '\n';
+    }
+
+    return result;
+}
@@ -0,0 +1,31 @@
+#include "misc/JobSystem.hpp"
+
+JobSystem::JobSystem(unsigned threadCount)
+{
+    workers.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i)
+    {
+        workers.emplace_back(
+            [this](std::stop_token stopToken) { work(stopToken); });
+    }
+}
+
+void JobSystem::work(std::stop_token stopToken)
+{
+    while (true)
+    {
+        auto&& job = std::function<void()>();
+
+        {
+            auto&& lock = std::unique_lock(mutex);
+            if (!jobAvailable.wait(
+                    lock, stopToken, [this] { return !jobs.empty(); }))
+                return;
+
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        job();
+    }
+}
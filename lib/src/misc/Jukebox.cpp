@@ -1,25 +1,107 @@
 #include "misc/Jukebox.hpp"
+#include "misc/Tracer.hpp"
+
+constexpr auto CROSSFADE_DURATION = std::chrono::milliseconds(500);
+constexpr auto CROSSFADE_TICK = std::chrono::milliseconds(20);
 
 Jukebox::Jukebox(
-    const dgm::ResourceManager& resmgr, const std::filesystem::path& rootDir)
-    : ROOT_DIR(rootDir), playlist(resmgr.get<Playlist>("playlist.json"))
+    const ResourceCache& resmgr,
+    const AssetArchive& archive,
+    const std::filesystem::path& rootDir)
+    : archive(archive)
+    , ROOT_DIR(rootDir)
+    , playlist(resmgr.get<Playlist>("playlist.json"))
+    , rng(std::random_device()())
+    , worker([this](std::stop_token stopToken) { work(stopToken); })
 {
+    post(
+        [this]
+        {
+            for (auto&& kind : { TrackKind::Title, TrackKind::Ingame })
+                prefetched[static_cast<std::size_t>(kind)] = prefetch(kind);
+        });
 }
 
-template<class T>
-T getRandomArrayItem(const std::vector<T>& vec)
+void Jukebox::playTitleTrack()
 {
-    return vec[rand() % vec.size()];
+    post([this] { play(TrackKind::Title); });
 }
 
-void Jukebox::playTitleTrack()
+void Jukebox::playIngameTrack()
 {
-    playSong(getRandomArrayItem(playlist.menu));
+    post([this] { play(TrackKind::Ingame); });
 }
 
-void Jukebox::playIngameTrack()
+void Jukebox::pause()
 {
-    playSong(getRandomArrayItem(playlist.game));
+    post(
+        [this]
+        {
+            paused = true;
+            for (auto&& track : { &current, &fadingOut })
+                if (track->music) track->music->pause();
+        });
+}
+
+void Jukebox::resume()
+{
+    post(
+        [this]
+        {
+            paused = false;
+            for (auto&& track : { &current, &fadingOut })
+                if (track->music) track->music->play();
+        });
+}
+
+void Jukebox::setVolume(float newVolume)
+{
+    post(
+        [this, newVolume]
+        {
+            volume = newVolume;
+            if (crossfadeStart)
+                updateCrossfade();
+            else if (current.music)
+                current.music->setVolume(volume);
+        });
+}
+
+void Jukebox::post(std::function<void()> command)
+{
+    {
+        auto&& lock = std::scoped_lock(mutex);
+        commands.push_back(std::move(command));
+    }
+    commandAvailable.notify_one();
+}
+
+void Jukebox::work(std::stop_token stopToken)
+{
+    while (!stopToken.stop_requested())
+    {
+        auto&& command = std::function<void()>();
+        {
+            auto&& lock = std::unique_lock(mutex);
+            auto&& hasCommand = [&] { return !commands.empty(); };
+
+            // Wakes up periodically only while a crossfade is running
+            if (crossfadeStart)
+                commandAvailable.wait_for(
+                    lock, stopToken, CROSSFADE_TICK, hasCommand);
+            else
+                commandAvailable.wait(lock, stopToken, hasCommand);
+
+            if (!commands.empty())
+            {
+                command = std::move(commands.front());
+                commands.pop_front();
+            }
+        }
+
+        if (command) command();
+        if (crossfadeStart) updateCrossfade();
+    }
 }
 
 std::filesystem::path Jukebox::getSongPath(const std::string& songName) const
@@ -27,9 +109,60 @@ std::filesystem::path Jukebox::getSongPath(const std::string& songName) const
     return ROOT_DIR / "music" / songName;
 }
 
-void Jukebox::playSong(const std::string& songName)
+Jukebox::Track Jukebox::prefetch(TrackKind kind)
+{
+    auto&& songs = kind == TrackKind::Title ? playlist.menu : playlist.game;
+    if (songs.empty()) return {};
+
+    auto&& name = songs[rng() % songs.size()];
+    auto&& trace = TraceScope(name, "music");
+
+    // Music is streamed, straight from the mapping when it is archived
+    auto&& music = std::make_unique<sf::Music>();
+    const auto path = getSongPath(name);
+    auto&& data = archive.find(path);
+    const auto opened = data ? music->openFromMemory(data->data(), data->size())
+                             : music->openFromFile(path);
+    if (!opened) return {};
+
+    music->setLooping(true);
+    return Track { .name = name, .music = std::move(music) };
+}
+
+void Jukebox::play(TrackKind kind)
+{
+    auto&& next = prefetched[static_cast<std::size_t>(kind)];
+    if (!next.music) next = prefetch(kind);
+    if (!next.music) return;
+
+    if (next.name != current.name || !current.music)
+    {
+        // A crossfade still running is cut short
+        fadingOut = std::move(current);
+        current = std::move(next);
+        current.music->setVolume(0.f);
+        if (!paused) current.music->play();
+        crossfadeStart = Clock::now();
+        updateCrossfade();
+    }
+
+    // Even when the song was already playing, so the next
+    // request of this kind can pick a different one
+    next = prefetch(kind);
+}
+
+void Jukebox::updateCrossfade()
 {
-    std::ignore = song.openFromFile(getSongPath(songName));
-    song.setLooping(true);
-    song.play();
+    const auto elapsed = Clock::now() - *crossfadeStart;
+    const auto progress = std::min(
+        1.f,
+        std::chrono::duration<float>(elapsed)
+            / std::chrono::duration<float>(CROSSFADE_DURATION));
+
+    if (current.music) current.music->setVolume(volume * progress);
+    if (fadingOut.music) fadingOut.music->setVolume(volume * (1.f - progress));
+
+    if (progress < 1.f) return;
+    fadingOut = {};
+    crossfadeStart.reset();
 }
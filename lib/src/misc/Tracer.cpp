@@ -0,0 +1,93 @@
+#include "misc/Tracer.hpp"
+#include <algorithm>
+#include <nlohmann/json.hpp>
+
+// Timestamps are relative to program start. Taking the origin on first
+// use would place it after the start of the first recorded event.
+static const Tracer::Clock::time_point ORIGIN = Tracer::Clock::now();
+
+struct [[nodiscard]] TraceStorage final
+{
+    std::mutex mutex;
+    std::vector<Tracer::Event> events;
+    std::vector<std::thread::id> threadIds;
+};
+
+static TraceStorage& getStorage()
+{
+    static TraceStorage storage;
+    return storage;
+}
+
+static std::size_t getThreadIdx(TraceStorage& storage)
+{
+    const auto id = std::this_thread::get_id();
+    auto&& itr = std::ranges::find(storage.threadIds, id);
+    if (itr != storage.threadIds.end())
+        return itr - storage.threadIds.begin();
+
+    storage.threadIds.push_back(id);
+    return storage.threadIds.size() - 1;
+}
+
+static std::int64_t toMicroseconds(Tracer::Clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+        .count();
+}
+
+void Tracer::record(
+    std::string name,
+    const char* category,
+    Clock::time_point start,
+    Clock::time_point end)
+{
+    auto&& storage = getStorage();
+    auto&& lock = std::scoped_lock(storage.mutex);
+    if (storage.events.size() >= MAX_EVENT_COUNT) return;
+
+    storage.events.push_back(Event {
+        .name = std::move(name),
+        .category = category,
+        .startUs = toMicroseconds(start - ORIGIN),
+        .durationUs = toMicroseconds(end - start),
+        .threadIdx = getThreadIdx(storage),
+    });
+}
+
+std::vector<Tracer::Event> Tracer::getEvents()
+{
+    auto&& storage = getStorage();
+    auto&& lock = std::scoped_lock(storage.mutex);
+    return storage.events;
+}
+
+std::string Tracer::exportChromeTrace()
+{
+    auto&& events = nlohmann::json::array();
+    for (auto&& event : getEvents())
+    {
+        events.push_back({
+            { "name", event.name },
+            { "cat", event.category },
+            { "ph", "X" },
+            { "ts", event.startUs },
+            { "dur", event.durationUs },
+            { "pid", 1 },
+            { "tid", event.threadIdx },
+        });
+    }
+
+    return nlohmann::json {
+        { "traceEvents", std::move(events) },
+        { "displayTimeUnit", "ms" },
+    }
+        .dump();
+}
+
+void Tracer::clear()
+{
+    auto&& storage = getStorage();
+    auto&& lock = std::scoped_lock(storage.mutex);
+    storage.events.clear();
+}
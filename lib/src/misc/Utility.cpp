@@ -1,12 +1,29 @@
 #include "misc/Utility.hpp"
+#include <algorithm>
+#include <array>
 
 std::string Utility::formatTime(const float value)
+{
+    auto&& buffer = std::array<char, 32>();
+    return std::string(formatTime(value, buffer));
+}
+
+std::string_view
+Utility::formatTime(const float value, std::span<char> buffer)
 {
     const auto minutes = static_cast<int>(value / 60.f);
     float seconds = 0;
     const auto fractional =
         static_cast<int>(100.f * std::modf(value - 60.f * minutes, &seconds));
-    return uni::format("{:02}:{:02.0f}.{:02d}", minutes, seconds, fractional);
+    const auto result = uni::format_to_n(
+        buffer.data(),
+        buffer.size(),
+        "{:02}:{:02.0f}.{:02d}",
+        minutes,
+        seconds,
+        fractional);
+    return { buffer.data(),
+             std::min(static_cast<std::size_t>(result.size), buffer.size()) };
 }
 
 std::optional<float>
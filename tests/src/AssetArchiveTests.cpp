@@ -0,0 +1,107 @@
+#include "Paths.hpp"
+#include <catch_amalgamated.hpp>
+#include <filesystem/AssetArchive.hpp>
+#include <filesystem/LevelPack.hpp>
+#include <fstream>
+#include <sstream>
+
+static std::string readText(const std::filesystem::path& path)
+{
+    auto&& stream = std::stringstream();
+    stream << std::ifstream(path).rdbuf();
+    return stream.str();
+}
+
+TEST_CASE("[AssetArchive]")
+{
+    auto&& bytes = AssetArchive::compile(TESTFILES_PATH);
+
+    SECTION("Files read from the archive equal files on disk")
+    {
+        const auto archive =
+            AssetArchive(std::move(bytes), TESTFILES_PATH);
+        REQUIRE(
+            archive.getFilePaths()
+            == std::vector<std::string> { "tiled-map-01.json",
+                                          "tiled-map-02.json" });
+
+        auto&& data = archive.find(TESTFILES_PATH / "tiled-map-02.json");
+        REQUIRE(data.has_value());
+        auto&& text = std::string(
+            reinterpret_cast<const char*>(data->data()), data->size());
+        REQUIRE(text == readText(TESTFILES_PATH / "tiled-map-02.json"));
+    }
+
+    SECTION("Contents are aligned")
+    {
+        const auto archive =
+            AssetArchive(std::move(bytes), TESTFILES_PATH);
+        for (auto&& path : archive.getFilePaths())
+        {
+            auto&& data = archive.find(TESTFILES_PATH / path);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(data->data()) % 16 == 0);
+        }
+    }
+
+    SECTION("Doesn't find files outside of the mount point")
+    {
+        const auto archive =
+            AssetArchive(std::move(bytes), TESTFILES_PATH);
+        REQUIRE_FALSE(archive.find(TESTFILES_PATH / "missing.json"));
+        REQUIRE_FALSE(archive.find(ASSETS_PATH / "tiled-map-01.json"));
+        REQUIRE_FALSE(AssetArchive().find("tiled-map-01.json"));
+    }
+
+    SECTION("Rejects truncated archive")
+    {
+        bytes.pop_back();
+        REQUIRE_THROWS(AssetArchive(std::move(bytes), TESTFILES_PATH));
+    }
+}
+
+TEST_CASE("[AssetArchive] Contents")
+{
+    const auto rootDir =
+        std::filesystem::temp_directory_path() / "asset-archive-contents";
+    std::filesystem::remove_all(rootDir);
+    for (auto&& path : { "levels.pack",
+                         "graphics/ball.png",
+                         "graphics/ball.png.anim",
+                         "graphics/tileset.png.clip",
+                         "fonts/LICENSE.txt",
+                         "levels/001.json",
+                         "ui-themes/Black.png",
+                         "music/playlist.json" })
+    {
+        std::filesystem::create_directories((rootDir / path).parent_path());
+        std::ofstream(rootDir / path) << path;
+    }
+
+    SECTION("Leaves out files that are read through their paths")
+    {
+        const auto archive =
+            AssetArchive(AssetArchive::compile(rootDir), rootDir);
+        REQUIRE(
+            archive.getFilePaths()
+            == std::vector<std::string> { "graphics/ball.png",
+                                          "levels.pack",
+                                          "music/playlist.json" });
+    }
+
+    SECTION("Stores extra files under their archived path")
+    {
+        const auto archive = AssetArchive(
+            AssetArchive::compile(
+                rootDir, { { "levels.pack", rootDir / "levels/001.json" } }),
+            rootDir);
+
+        auto&& data = archive.find(rootDir / "levels.pack");
+        REQUIRE(data.has_value());
+        REQUIRE(
+            std::string(
+                reinterpret_cast<const char*>(data->data()), data->size())
+            == "levels/001.json");
+    }
+
+    std::filesystem::remove_all(rootDir);
+}
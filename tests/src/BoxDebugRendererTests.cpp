@@ -0,0 +1,55 @@
+#include <array>
+#include <catch_amalgamated.hpp>
+#include <game/BoxDebugRenderer.hpp>
+
+TEST_CASE("[BoxDebugRenderer]")
+{
+    const auto color = b2Color(1.f, 0.f, 0.f);
+    const auto square = std::array {
+        b2Vec2(1.f, 1.f),
+        b2Vec2(2.f, 1.f),
+        b2Vec2(2.f, 2.f),
+        b2Vec2(1.f, 2.f),
+    };
+    auto&& renderer = BoxDebugRenderer();
+    renderer.begin(sf::FloatRect({ 0.f, 0.f }, { 640.f, 360.f }));
+
+    SECTION("Collects visible shapes into shared vertex lists")
+    {
+        renderer.DrawSolidPolygon(square.data(), 4, color);
+        renderer.DrawPolygon(square.data(), 4, color);
+        renderer.DrawSolidCircle(b2Vec2(3.f, 3.f), 1.f, b2Vec2(), color);
+        renderer.DrawCircle(b2Vec2(3.f, 3.f), 1.f, color);
+        renderer.DrawSegment(b2Vec2(0.f, 5.f), b2Vec2(4.f, 5.f), color);
+
+        REQUIRE(
+            renderer.getTriangleVertexCount()
+            == 6u + 3u * BoxDebugRenderer::CIRCLE_SEGMENT_COUNT);
+        REQUIRE(
+            renderer.getLineVertexCount()
+            == 8u + 2u * BoxDebugRenderer::CIRCLE_SEGMENT_COUNT + 2u);
+    }
+
+    SECTION("Skips shapes outside of the visible area")
+    {
+        renderer.begin(sf::FloatRect({ 320.f, 320.f }, { 640.f, 360.f }));
+        renderer.DrawSolidPolygon(square.data(), 4, color);
+        renderer.DrawSolidCircle(b2Vec2(3.f, 3.f), 1.f, b2Vec2(), color);
+        renderer.DrawSegment(b2Vec2(0.f, 5.f), b2Vec2(4.f, 5.f), color);
+
+        // Straight segment touching the area is kept
+        renderer.DrawSegment(b2Vec2(10.f, 0.f), b2Vec2(10.f, 20.f), color);
+
+        REQUIRE(renderer.getTriangleVertexCount() == 0u);
+        REQUIRE(renderer.getLineVertexCount() == 2u);
+    }
+
+    SECTION("Begin drops geometry of the previous frame")
+    {
+        renderer.DrawSolidPolygon(square.data(), 4, color);
+        renderer.begin(sf::FloatRect({ 0.f, 0.f }, { 640.f, 360.f }));
+
+        REQUIRE(renderer.getTriangleVertexCount() == 0u);
+        REQUIRE(renderer.getLineVertexCount() == 0u);
+    }
+}
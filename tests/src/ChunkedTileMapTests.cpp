@@ -0,0 +1,38 @@
+#include <catch_amalgamated.hpp>
+#include <game/ChunkedTileMap.hpp>
+
+TEST_CASE("[ChunkedTileMap]")
+{
+    const auto chunkSize = sf::Vector2f(256.f, 256.f);
+    const auto chunkCount = sf::Vector2u(10u, 4u);
+
+    SECTION("Returns chunks intersecting the area")
+    {
+        const auto range = ChunkedTileMap::getVisibleChunks(
+            sf::FloatRect({ 300.f, 100.f }, { 640.f, 360.f }),
+            chunkSize,
+            chunkCount);
+        REQUIRE(range.begin == sf::Vector2u(1u, 0u));
+        REQUIRE(range.end == sf::Vector2u(4u, 2u));
+    }
+
+    SECTION("Skips chunks the area only touches")
+    {
+        const auto range = ChunkedTileMap::getVisibleChunks(
+            sf::FloatRect({ 256.f, 256.f }, { 256.f, 256.f }),
+            chunkSize,
+            chunkCount);
+        REQUIRE(range.begin == sf::Vector2u(1u, 1u));
+        REQUIRE(range.end == sf::Vector2u(2u, 2u));
+    }
+
+    SECTION("Clamps the area to the map")
+    {
+        const auto range = ChunkedTileMap::getVisibleChunks(
+            sf::FloatRect({ -320.f, 900.f }, { 640.f, 360.f }),
+            chunkSize,
+            chunkCount);
+        REQUIRE(range.begin == sf::Vector2u(0u, 3u));
+        REQUIRE(range.end == sf::Vector2u(2u, 4u));
+    }
+}
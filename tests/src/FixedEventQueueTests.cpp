@@ -0,0 +1,166 @@
+#include <catch_amalgamated.hpp>
+#include <game/events/EventQueue.hpp>
+#include <game/events/FixedEventQueue.hpp>
+#include <misc/Compatibility.hpp>
+#include <vector>
+
+namespace
+{
+    struct [[nodiscard]] PlainEvent final
+    {
+        int value = 0;
+    };
+
+    struct [[nodiscard]] FirstOnlyEvent final
+    {
+        int value = 0;
+    };
+
+    struct [[nodiscard]] LatestOnlyEvent final
+    {
+        int value = 0;
+    };
+
+    struct [[nodiscard]] OtherEvent final
+    {
+        int value = 0;
+    };
+
+    using TestEvent =
+        std::variant<PlainEvent, FirstOnlyEvent, LatestOnlyEvent>;
+
+    using BenchmarkEvent = std::variant<PlainEvent, OtherEvent>;
+
+    struct [[nodiscard]] Recorder final
+    {
+        std::vector<int> values;
+
+        void operator()(const PlainEvent& e)
+        {
+            values.push_back(e.value);
+        }
+
+        void operator()(const FirstOnlyEvent& e)
+        {
+            values.push_back(100 + e.value);
+        }
+
+        void operator()(const LatestOnlyEvent& e)
+        {
+            values.push_back(200 + e.value);
+        }
+    };
+
+    struct [[nodiscard]] Summer final
+    {
+        int sum = 0;
+
+        void operator()(const auto& e)
+        {
+            sum += e.value;
+        }
+    };
+} // namespace
+
+template<>
+constexpr DedupPolicy EVENT_DEDUP_POLICY<FirstOnlyEvent> =
+    DedupPolicy::KeepFirst;
+
+template<>
+constexpr DedupPolicy EVENT_DEDUP_POLICY<LatestOnlyEvent> =
+    DedupPolicy::KeepLatest;
+
+TEST_CASE("[FixedEventQueue]")
+{
+    auto&& queue = FixedEventQueue<TestEvent, 4>();
+    auto&& recorder = Recorder();
+
+    SECTION("Processes events in the order they were pushed")
+    {
+        queue.pushEvent<PlainEvent>(1);
+        queue.pushEvent<FirstOnlyEvent>(2);
+        queue.pushEvent<PlainEvent>(3);
+        queue.processEvents(recorder);
+
+        REQUIRE(recorder.values == std::vector { 1, 102, 3 });
+        REQUIRE(queue.getSize() == 0u);
+    }
+
+    SECTION("Drops and counts events pushed into a full queue")
+    {
+        for (int i = 0; i < 6; ++i)
+            queue.pushEvent<PlainEvent>(i);
+        queue.processEvents(recorder);
+
+        REQUIRE(recorder.values == std::vector { 0, 1, 2, 3 });
+        REQUIRE(queue.getOverflowCount() == 2u);
+    }
+
+    SECTION("Deduplicates pending events by their policy")
+    {
+        queue.pushEvent<FirstOnlyEvent>(1);
+        queue.pushEvent<LatestOnlyEvent>(1);
+        queue.pushEvent<FirstOnlyEvent>(2);
+        queue.pushEvent<LatestOnlyEvent>(2);
+        queue.pushEvent<PlainEvent>(7);
+        queue.processEvents(recorder);
+
+        REQUIRE(recorder.values == std::vector { 101, 202, 7 });
+
+        // Processed events no longer count as pending
+        queue.pushEvent<FirstOnlyEvent>(3);
+        queue.processEvents(recorder);
+        REQUIRE(recorder.values.back() == 103);
+    }
+
+    SECTION("Processes events pushed by the visitor in the same call")
+    {
+        int processed = 0;
+        queue.pushEvent<PlainEvent>(0);
+        queue.processEvents(
+            [&](const auto& e)
+            {
+                ++processed;
+                if (e.value < 9) queue.pushEvent<PlainEvent>(e.value + 1);
+            });
+
+        REQUIRE(processed == 10);
+    }
+}
+
+TEST_CASE("[FixedEventQueue] Benchmark", "[.][benchmark]")
+{
+    for (int count : { 1, 100, 10000 })
+    {
+        auto&& vectorQueue = EventQueue<BenchmarkEvent>();
+        auto&& fixedQueue = FixedEventQueue<BenchmarkEvent, 16384>();
+
+        BENCHMARK(uni::format("EventQueue, {} events per frame", count))
+        {
+            auto&& summer = Summer();
+            for (int i = 0; i < count; ++i)
+            {
+                if (i % 2 == 0)
+                    vectorQueue.pushEvent<PlainEvent>(i);
+                else
+                    vectorQueue.pushEvent<OtherEvent>(i);
+            }
+            vectorQueue.processEvents(summer);
+            return summer.sum;
+        };
+
+        BENCHMARK(uni::format("FixedEventQueue, {} events per frame", count))
+        {
+            auto&& summer = Summer();
+            for (int i = 0; i < count; ++i)
+            {
+                if (i % 2 == 0)
+                    fixedQueue.pushEvent<PlainEvent>(i);
+                else
+                    fixedQueue.pushEvent<OtherEvent>(i);
+            }
+            fixedQueue.processEvents(summer);
+            return summer.sum;
+        };
+    }
+}
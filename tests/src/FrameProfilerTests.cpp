@@ -0,0 +1,64 @@
+#include <catch_amalgamated.hpp>
+#include <misc/FrameProfiler.hpp>
+
+TEST_CASE("[FrameProfiler]")
+{
+    auto&& profiler = FrameProfiler();
+
+    SECTION("Computes percentiles per phase")
+    {
+        for (unsigned i = 1; i <= 100; ++i)
+        {
+            profiler.beginFrame();
+            profiler.record(FramePhase::Physics, static_cast<float>(i));
+            profiler.record(FramePhase::Physics, 1.f);
+        }
+        profiler.beginFrame();
+
+        const auto stats = profiler.computeStats(FramePhase::Physics);
+        REQUIRE(stats.min == 2.f);
+        REQUIRE(stats.avg == Catch::Approx(51.5f));
+        REQUIRE(stats.p95 == 96.f);
+        REQUIRE(stats.p99 == 100.f);
+        REQUIRE(profiler.computeStats(FramePhase::Hud).p99 == 0.f);
+    }
+
+    SECTION("Leaves out the frame still being recorded")
+    {
+        profiler.beginFrame();
+        profiler.record(FramePhase::Hud, 5.f);
+        REQUIRE(profiler.computeStats(FramePhase::Hud).avg == 0.f);
+
+        profiler.beginFrame();
+        profiler.record(FramePhase::Input, 1.f);
+        REQUIRE(profiler.computeStats(FramePhase::Hud).min == 5.f);
+        REQUIRE(profiler.computeStats(FramePhase::Input).avg == 0.f);
+    }
+
+    SECTION("Keeps only the last frames")
+    {
+        for (unsigned i = 0; i < FrameProfiler::CAPACITY + 10; ++i)
+        {
+            profiler.beginFrame();
+            profiler.record(FramePhase::Input, static_cast<float>(i));
+        }
+
+        REQUIRE(profiler.getFrameCount() == FrameProfiler::CAPACITY);
+        REQUIRE(profiler.computeStats(FramePhase::Input).min == 10.f);
+    }
+
+    SECTION("Exports frames from the oldest as CSV")
+    {
+        for (unsigned i = 0; i < FrameProfiler::CAPACITY + 1; ++i)
+        {
+            profiler.beginFrame();
+            profiler.record(FramePhase::Display, static_cast<float>(i));
+        }
+
+        const auto csv = profiler.exportCsv();
+        REQUIRE(csv.starts_with(
+            "frame,input,rules,physics,world,hud,gui,display\n"
+            "0,0.000,0.000,0.000,0.000,0.000,0.000,1.000\n"));
+        REQUIRE(csv.ends_with(",512.000\n"));
+    }
+}
@@ -0,0 +1,86 @@
+#include "Paths.hpp"
+#include <catch_amalgamated.hpp>
+#include <filesystem/TiledLoader.hpp>
+#include <game/SceneBuilder.hpp>
+#include <game/SimulationConstants.hpp>
+#include <game/engine/GameRulesEngine.hpp>
+
+TEST_CASE("[GameRulesEngine]")
+{
+    const auto level = SceneBuilder::convertToTiledLevel(
+        TiledLoader::loadLevel(ASSETS_PATH / "levels" / "001.json"));
+    auto scene = SceneBuilder::buildScene(level);
+    auto gameEvents = EventQueue<GameEvent>();
+    auto audioEvents = AudioEventQueue();
+    auto settings = InputSettings {};
+    auto engine = GameRulesEngine(gameEvents, audioEvents, scene, settings);
+
+    engine.update(0.f, GameInput { .start = true });
+    REQUIRE(scene.playing);
+
+    SECTION("Advances in whole ticks")
+    {
+        engine.update(SIMULATION_TIMESTEP * 2.5f, GameInput {});
+        REQUIRE(scene.timer == 2u);
+        REQUIRE(scene.interpolation == Catch::Approx(0.5f).margin(0.01f));
+    }
+
+    SECTION("Caps number of ticks after a hitch")
+    {
+        engine.update(10.f, GameInput {});
+        REQUIRE(scene.timer == MAX_SIMULATION_STEPS_PER_FRAME);
+    }
+
+    SECTION("Simulation does not depend on frame rate")
+    {
+        auto otherScene = SceneBuilder::buildScene(level);
+        auto otherEngine =
+            GameRulesEngine(gameEvents, audioEvents, otherScene, settings);
+        otherEngine.update(0.f, GameInput { .start = true });
+
+        for (unsigned i = 0; i < 120; ++i)
+            engine.update(SIMULATION_TIMESTEP, GameInput {});
+        for (unsigned i = 0; i < 30; ++i)
+            otherEngine.update(
+                SIMULATION_TIMESTEP * 4.f + 1e-5f, GameInput {});
+
+        REQUIRE(scene.timer == otherScene.timer);
+        REQUIRE(scene.joe.GetPosition().x == otherScene.joe.GetPosition().x);
+        REQUIRE(scene.joe.GetPosition().y == otherScene.joe.GetPosition().y);
+    }
+
+    SECTION("Restoring spawn snapshot restarts the level in place")
+    {
+        for (unsigned i = 0; i < 60; ++i)
+            engine.update(
+                SIMULATION_TIMESTEP, GameInput { .magnetizeRed = true });
+        scene.contactListener->died = true;
+
+        engine.restoreSnapshot(scene.spawnSnapshot);
+
+        REQUIRE_FALSE(scene.playing);
+        REQUIRE_FALSE(scene.contactListener->died);
+        REQUIRE(scene.timer == 0u);
+        REQUIRE(scene.magnetPolarity == MAGNET_POLARITY_NONE);
+        REQUIRE(scene.joe.GetPosition().x == scene.spawnSnapshot.joePosition.x);
+        REQUIRE(scene.joe.GetPosition().y == scene.spawnSnapshot.joePosition.y);
+        REQUIRE(scene.joe.GetLinearVelocity().x == 0.f);
+        REQUIRE(scene.joe.GetLinearVelocity().y == 0.f);
+    }
+
+    SECTION("Snapshot round-trips the dynamic state")
+    {
+        for (unsigned i = 0; i < 30; ++i)
+            engine.update(SIMULATION_TIMESTEP, GameInput {});
+        const auto snapshot = engine.takeSnapshot();
+
+        for (unsigned i = 0; i < 30; ++i)
+            engine.update(SIMULATION_TIMESTEP, GameInput {});
+        engine.restoreSnapshot(snapshot);
+
+        REQUIRE(scene.timer == snapshot.timer);
+        REQUIRE(scene.joe.GetPosition().y == snapshot.joePosition.y);
+        REQUIRE(
+            scene.joe.GetLinearVelocity().y == snapshot.joeLinearVelocity.y);
+    }
+}
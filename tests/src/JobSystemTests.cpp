@@ -0,0 +1,31 @@
+#include <catch_amalgamated.hpp>
+#include <misc/JobSystem.hpp>
+#include <stdexcept>
+
+TEST_CASE("[JobSystem]")
+{
+    auto&& jobs = JobSystem(4);
+
+    SECTION("Returns results of jobs through futures")
+    {
+        auto&& futures = std::vector<std::future<int>>();
+        for (int i = 0; i < 100; ++i)
+            futures.push_back(jobs.submit([i] { return i * i; }));
+
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(futures[i].get() == i * i);
+    }
+
+    SECTION("Runs jobs on worker threads")
+    {
+        auto&& future = jobs.submit([] { return std::this_thread::get_id(); });
+        REQUIRE(future.get() != std::this_thread::get_id());
+    }
+
+    SECTION("Rethrows exception of a job")
+    {
+        auto&& future =
+            jobs.submit([]() -> int { throw std::runtime_error("failed"); });
+        REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+    }
+}
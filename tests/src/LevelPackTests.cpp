@@ -0,0 +1,107 @@
+#include "Paths.hpp"
+#include <catch_amalgamated.hpp>
+#include <filesystem/LevelPack.hpp>
+#include <filesystem/TiledLoader.hpp>
+#include <fstream>
+#include <game/SceneBuilder.hpp>
+
+static std::vector<std::pair<std::string, TiledLevel>> loadJsonLevels()
+{
+    auto&& levels = std::vector<std::pair<std::string, TiledLevel>>();
+    for (auto&& entry :
+         std::filesystem::directory_iterator(ASSETS_PATH / "levels"))
+    {
+        if (entry.path().extension() != ".json") continue;
+        levels.emplace_back(
+            entry.path().filename().string(),
+            SceneBuilder::convertToTiledLevel(
+                TiledLoader::loadLevel(entry.path())));
+    }
+    return levels;
+}
+
+TEST_CASE("[LevelPack]")
+{
+    const auto levels = loadJsonLevels();
+    auto&& bytes = LevelPack::compile(levels);
+
+    SECTION("Levels read from the pack equal levels read from JSON")
+    {
+        const auto pack = LevelPack(std::move(bytes));
+
+        REQUIRE(pack.getLevelIds().size() == levels.size());
+        REQUIRE(std::ranges::is_sorted(pack.getLevelIds()));
+
+        for (auto&& [name, expected] : levels)
+        {
+            const auto level = pack.getLevel(name);
+            REQUIRE(level.width == expected.width);
+            REQUIRE(level.height == expected.height);
+            REQUIRE(level.tileWidth == expected.tileWidth);
+            REQUIRE(level.tileHeight == expected.tileHeight);
+            REQUIRE(level.tileLayers.size() == 1u);
+            REQUIRE(level.tileLayers[0].id == expected.tileLayers[0].id);
+            REQUIRE(
+                level.tileLayers[0].tiles == expected.tileLayers[0].tiles);
+
+            auto&& objects = level.objectLayers.at(0).objects;
+            auto&& expectedObjects = expected.objectLayers[0].objects;
+            REQUIRE(objects.size() == expectedObjects.size());
+            for (size_t i = 0; i < objects.size(); ++i)
+            {
+                REQUIRE(objects[i].position == expectedObjects[i].position);
+                REQUIRE(objects[i].kind == expectedObjects[i].kind);
+                REQUIRE(objects[i].data == expectedObjects[i].data);
+            }
+        }
+    }
+
+    SECTION("Can be memory mapped from a file")
+    {
+        const auto path =
+            std::filesystem::temp_directory_path() / "magrider-test.pack";
+        {
+            auto&& file = std::ofstream(path, std::ios::binary);
+            file.write(
+                reinterpret_cast<const char*>(bytes.data()), bytes.size());
+        }
+
+        {
+            auto&& mapped = MappedFile::open(path);
+            REQUIRE(mapped.has_value());
+            REQUIRE(mapped->getBytes().size() == bytes.size());
+
+            const auto pack = LevelPack(std::move(*mapped));
+            auto&& [name, level] = levels.front();
+            REQUIRE(
+                pack.getTiles(name).size()
+                == level.tileLayers[0].tiles.size());
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    SECTION("Missing file is not an error")
+    {
+        REQUIRE_FALSE(MappedFile::open(TESTFILES_PATH / "missing.pack"));
+    }
+
+    SECTION("Rejects corrupted pack")
+    {
+        bytes.back() ^= std::byte { 1 };
+        REQUIRE_THROWS(LevelPack(std::move(bytes)));
+    }
+
+    SECTION("Rejects truncated pack")
+    {
+        bytes.pop_back();
+        REQUIRE_THROWS(LevelPack(std::move(bytes)));
+    }
+
+    SECTION("Throws on unknown level")
+    {
+        const auto pack = LevelPack(std::move(bytes));
+        REQUIRE_FALSE(pack.contains("999.json"));
+        REQUIRE_THROWS(pack.getLevel("999.json"));
+    }
+}
@@ -0,0 +1,158 @@
+#include <catch_amalgamated.hpp>
+#include <game/MagnetForces.hpp>
+#include <game/MagnetGrid.hpp>
+#include <misc/Compatibility.hpp>
+#include <random>
+
+struct [[nodiscard]] MagnetArrays final
+{
+    std::vector<Magnet> magnets;
+    std::vector<float> xs;
+    std::vector<float> ys;
+    std::vector<int> polarities;
+
+    [[nodiscard]] MagnetSpan getSpan() const
+    {
+        return MagnetSpan {
+            .xs = xs.data(),
+            .ys = ys.data(),
+            .polarities = polarities.data(),
+            .count = polarities.size(),
+        };
+    }
+};
+
+static MagnetArrays generateMagnets(size_t count, unsigned seed)
+{
+    auto&& rng = std::mt19937(seed);
+    auto&& coord = std::uniform_real_distribution<float>(
+        -MAGNET_RANGE * 1.5f, MAGNET_RANGE * 1.5f);
+    auto&& result = MagnetArrays {};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto magnet = Magnet {
+            .position = { coord(rng), coord(rng) },
+            .polarity = static_cast<int>(rng() % 2) + MAGNET_POLARITY_RED,
+        };
+        result.magnets.push_back(magnet);
+        result.xs.push_back(magnet.position.x);
+        result.ys.push_back(magnet.position.y);
+        result.polarities.push_back(magnet.polarity);
+    }
+
+    return result;
+}
+
+// Array-of-structures loop computing two square roots per magnet
+static sf::Vector2f accumulateNaive(
+    const std::vector<Magnet>& magnets,
+    const sf::Vector2f& position,
+    int polarity)
+{
+    sf::Vector2f totalForce = {};
+    for (auto&& magnet : magnets)
+    {
+        const auto direction = position - magnet.position;
+        if (direction.length() < MAGNET_RANGE && direction.length() > 0.f)
+        {
+            totalForce += direction.normalized() * MAGNET_FORCE
+                          * (polarity == magnet.polarity ? 1.f : -1.f);
+        }
+    }
+    return totalForce;
+}
+
+TEST_CASE("[MagnetForces]")
+{
+    SECTION("Vectorized kernel matches naive loop")
+    {
+        // Counts not divisible by four exercise the scalar tail
+        for (size_t count : { 0u, 1u, 3u, 4u, 7u, 64u, 1001u })
+        {
+            const auto data = generateMagnets(count, 42u);
+            for (int polarity : { MAGNET_POLARITY_RED, MAGNET_POLARITY_BLUE })
+            {
+                const auto expected =
+                    accumulateNaive(data.magnets, {}, polarity);
+                const auto scalar = MagnetForces::accumulateScalar(
+                    data.getSpan(), {}, polarity);
+                const auto vectorized =
+                    MagnetForces::accumulate(data.getSpan(), {}, polarity);
+
+                const auto margin = 1e-4f * static_cast<float>(count + 1);
+                REQUIRE(scalar.x == Catch::Approx(expected.x).margin(margin));
+                REQUIRE(scalar.y == Catch::Approx(expected.y).margin(margin));
+                REQUIRE(
+                    vectorized.x == Catch::Approx(expected.x).margin(margin));
+                REQUIRE(
+                    vectorized.y == Catch::Approx(expected.y).margin(margin));
+            }
+        }
+    }
+
+    SECTION("Ignores magnets out of range or at the same position")
+    {
+        const auto xs = std::vector<float> { 0.f, MAGNET_RANGE, 0.f, 100.f };
+        const auto ys = std::vector<float> { 0.f, 0.f, -MAGNET_RANGE, 3.f };
+        const auto polarities = std::vector<int>(4, MAGNET_POLARITY_RED);
+        const auto span = MagnetSpan {
+            .xs = xs.data(),
+            .ys = ys.data(),
+            .polarities = polarities.data(),
+            .count = 4,
+        };
+
+        const auto force =
+            MagnetForces::accumulate(span, {}, MAGNET_POLARITY_RED);
+        REQUIRE(force.x == 0.f);
+        REQUIRE(force.y == 0.f);
+    }
+
+    SECTION("Same polarity repels, opposite attracts")
+    {
+        const auto xs = std::vector<float> { 1.f };
+        const auto ys = std::vector<float> { 0.f };
+        const auto polarities = std::vector<int> { MAGNET_POLARITY_RED };
+        const auto span = MagnetSpan {
+            .xs = xs.data(),
+            .ys = ys.data(),
+            .polarities = polarities.data(),
+            .count = 1,
+        };
+
+        REQUIRE(
+            MagnetForces::accumulate(span, {}, MAGNET_POLARITY_RED).x
+            == Catch::Approx(-MAGNET_FORCE));
+        REQUIRE(
+            MagnetForces::accumulate(span, {}, MAGNET_POLARITY_BLUE).x
+            == Catch::Approx(MAGNET_FORCE));
+    }
+}
+
+TEST_CASE("[MagnetForces] Benchmark", "[.][benchmark]")
+{
+    for (size_t count : { 10u, 1000u, 100000u })
+    {
+        const auto data = generateMagnets(count, 1337u);
+        const auto position = sf::Vector2f(0.5f, -0.25f);
+
+        BENCHMARK(uni::format("naive, {} magnets", count))
+        {
+            return accumulateNaive(
+                data.magnets, position, MAGNET_POLARITY_RED);
+        };
+
+        BENCHMARK(uni::format("scalar SoA, {} magnets", count))
+        {
+            return MagnetForces::accumulateScalar(
+                data.getSpan(), position, MAGNET_POLARITY_RED);
+        };
+
+        BENCHMARK(uni::format("vectorized SoA, {} magnets", count))
+        {
+            return MagnetForces::accumulate(
+                data.getSpan(), position, MAGNET_POLARITY_RED);
+        };
+    }
+}
@@ -0,0 +1,53 @@
+#include <catch_amalgamated.hpp>
+#include <game/MagnetGrid.hpp>
+#include <random>
+
+TEST_CASE("[MagnetGrid]")
+{
+    auto&& rng = std::mt19937(1337);
+    auto&& magnets = std::vector<Magnet>();
+    for (unsigned i = 0; i < 500; ++i)
+    {
+        magnets.push_back(Magnet {
+            .position = { static_cast<float>(rng() % 100) + 0.5f,
+                          static_cast<float>(rng() % 40) + 0.5f },
+            .polarity = static_cast<int>(rng() % 2) + 1,
+        });
+    }
+
+    const auto grid = MagnetGrid(magnets, 100u, 40u);
+
+    SECTION("Contains all magnets")
+    {
+        REQUIRE(grid.size() == magnets.size());
+    }
+
+    SECTION("Finds the same magnets in range as a linear scan")
+    {
+        auto&& isInRange = [](const sf::Vector2f& a, const sf::Vector2f& b)
+        { return (a - b).length() < MAGNET_RANGE; };
+
+        for (unsigned i = 0; i < 1000; ++i)
+        {
+            // Deliberately also sample points outside of the level
+            const auto point = sf::Vector2f(
+                static_cast<float>(rng() % 12000) / 100.f - 10.f,
+                static_cast<float>(rng() % 6000) / 100.f - 10.f);
+
+            const auto expected = std::ranges::count_if(
+                magnets,
+                [&](const Magnet& magnet)
+                { return isInRange(point, magnet.position); });
+
+            size_t found = 0;
+            grid.forEachNear(
+                point,
+                [&](const Magnet& magnet)
+                {
+                    if (isInRange(point, magnet.position)) ++found;
+                });
+
+            REQUIRE(found == static_cast<size_t>(expected));
+        }
+    }
+}
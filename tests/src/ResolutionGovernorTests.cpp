@@ -0,0 +1,57 @@
+#include <catch_amalgamated.hpp>
+#include <game/ResolutionGovernor.hpp>
+
+static void runWindows(
+    ResolutionGovernor& governor, unsigned windowCount, float frameTime)
+{
+    for (unsigned i = 0;
+         i < windowCount * ResolutionGovernor::WINDOW_FRAME_COUNT;
+         ++i)
+        governor.update(frameTime);
+}
+
+TEST_CASE("[ResolutionGovernor]")
+{
+    const auto target = 1.f / 60.f;
+    auto&& governor = ResolutionGovernor(3, target);
+
+    SECTION("Raises scale after frames stay within budget")
+    {
+        REQUIRE(governor.getScale() == 1u);
+
+        runWindows(governor, ResolutionGovernor::MIN_WINDOWS_TO_RAISE, target);
+        REQUIRE(governor.getScale() == 2u);
+
+        runWindows(
+            governor, ResolutionGovernor::MIN_WINDOWS_TO_RAISE * 4, target);
+        REQUIRE(governor.getScale() == 3u);
+    }
+
+    SECTION("Lowers scale after a window over budget")
+    {
+        runWindows(governor, ResolutionGovernor::MIN_WINDOWS_TO_RAISE, target);
+        runWindows(governor, 1, target * 2.f);
+        REQUIRE(governor.getScale() == 1u);
+
+        runWindows(governor, 1, target * 2.f);
+        REQUIRE(governor.getScale() == 1u);
+    }
+
+    SECTION("Waits longer before raising again after a failed raise")
+    {
+        runWindows(governor, ResolutionGovernor::MIN_WINDOWS_TO_RAISE, target);
+        runWindows(governor, 1, target * 2.f);
+
+        runWindows(governor, ResolutionGovernor::MIN_WINDOWS_TO_RAISE, target);
+        REQUIRE(governor.getScale() == 1u);
+
+        runWindows(governor, ResolutionGovernor::MIN_WINDOWS_TO_RAISE, target);
+        REQUIRE(governor.getScale() == 2u);
+    }
+
+    SECTION("Frames slightly over budget keep the scale")
+    {
+        runWindows(governor, 100, target * 1.1f);
+        REQUIRE(governor.getScale() == 1u);
+    }
+}
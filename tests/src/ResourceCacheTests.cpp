@@ -0,0 +1,70 @@
+#include <atomic>
+#include <catch_amalgamated.hpp>
+#include <filesystem/ResourceCache.hpp>
+
+TEST_CASE("[ResourceCache]")
+{
+    std::atomic<unsigned> loadCount = 0;
+    auto&& cache = ResourceCache(dgm::ResourceManager(), 10u);
+    cache.registerLazyType<std::string>(
+        "graphics",
+        [&](const std::filesystem::path& path)
+            -> std::expected<std::string, dgm::Error>
+        {
+            ++loadCount;
+            return path.filename().string();
+        },
+        [](const std::string& resource) { return resource.size(); },
+        [](const std::string& id) { return id.starts_with("level"); });
+
+    SECTION("Loads resource on first access only")
+    {
+        REQUIRE(cache.get<std::string>("title") == "title");
+        REQUIRE(cache.get<std::string>("title") == "title");
+        REQUIRE(loadCount == 1u);
+    }
+
+    SECTION("Counts only evictable resources")
+    {
+        (void)cache.get<std::string>("title");
+        (void)cache.get<std::string>("level1");
+        REQUIRE(cache.getEvictableByteSize() == 6u);
+    }
+
+    SECTION("Evicts least recently used resources over budget")
+    {
+        (void)cache.get<std::string>("level1");
+        (void)cache.get<std::string>("level2");
+        (void)cache.get<std::string>("level1");
+        (void)cache.get<std::string>("level3");
+        REQUIRE(cache.getEvictableByteSize() == 18u);
+
+        cache.evictOverBudget();
+        REQUIRE(cache.getEvictableByteSize() == 6u);
+
+        // level3 was used last and stayed loaded, level2 is reloaded
+        (void)cache.get<std::string>("level3");
+        REQUIRE(loadCount == 3u);
+        (void)cache.get<std::string>("level2");
+        REQUIRE(loadCount == 4u);
+    }
+
+    SECTION("Never evicts inserted resources")
+    {
+        REQUIRE(cache.insertResource<std::string>(
+            "level-icon", std::string(20u, 'x')));
+        cache.evictOverBudget();
+        REQUIRE(cache.get<std::string>("level-icon").size() == 20u);
+        REQUIRE(loadCount == 0u);
+    }
+
+    SECTION("Preloads resources on worker threads")
+    {
+        auto&& jobs = JobSystem(2);
+        cache.preload<std::string>(jobs, { "title", "level1", "level2" });
+        REQUIRE(loadCount == 3u);
+
+        (void)cache.get<std::string>("level1");
+        REQUIRE(loadCount == 3u);
+    }
+}
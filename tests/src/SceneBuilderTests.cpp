@@ -0,0 +1,185 @@
+#include "Paths.hpp"
+#include <catch_amalgamated.hpp>
+#include <filesystem/TiledLoader.hpp>
+#include <game/SceneBuilder.hpp>
+
+static TiledLevel
+createLevel(unsigned width, unsigned height, std::vector<Tile> tiles)
+{
+    return TiledLevel {
+        .width = width,
+        .height = height,
+        .tileWidth = 16,
+        .tileHeight = 16,
+        .tileLayers = { TileLayer { .id = 1, .tiles = std::move(tiles) } },
+        .objectLayers = {},
+    };
+}
+
+static PhysicsWorldStats
+countColliders(const TiledLevel& level, ColliderMode mode)
+{
+    auto world = Box2D::createWorld();
+    SceneBuilder::generateColliders(world, level, mode);
+    return Box2D::getStats(world);
+}
+
+TEST_CASE("[SceneBuilder]")
+{
+    constexpr auto E = Tile::Empty;
+    constexpr auto B = Tile::Block;
+    constexpr auto U = Tile::SpikeUp;
+    constexpr auto L = Tile::SpikeLeft;
+    constexpr auto S = Tile::FloorUp45;
+
+    SECTION("Merges solid block into a single rectangle")
+    {
+        // clang-format off
+        const auto level = createLevel(4, 3, {
+            B, B, B, E,
+            B, B, B, E,
+            B, B, B, B,
+        });
+        // clang-format on
+
+        REQUIRE(countColliders(level, ColliderMode::RowRuns).bodyCount == 3u);
+        REQUIRE(
+            countColliders(level, ColliderMode::MergedRectangles).bodyCount
+            == 2u);
+    }
+
+    SECTION("Merges spikes facing the same way")
+    {
+        // clang-format off
+        const auto level = createLevel(4, 3, {
+            L, E, E, E,
+            L, E, E, E,
+            E, U, U, U,
+        });
+        // clang-format on
+
+        REQUIRE(countColliders(level, ColliderMode::RowRuns).bodyCount == 5u);
+        REQUIRE(
+            countColliders(level, ColliderMode::MergedRectangles).bodyCount
+            == 2u);
+    }
+
+    SECTION("Merged colliders cover the same area")
+    {
+        const auto level = SceneBuilder::convertToTiledLevel(
+            TiledLoader::loadLevel(ASSETS_PATH / "levels" / "001.json"));
+
+        auto&& rowRuns = Box2D::createWorld();
+        SceneBuilder::generateColliders(
+            rowRuns, level, ColliderMode::RowRuns);
+        auto&& merged = Box2D::createWorld();
+        SceneBuilder::generateColliders(
+            merged, level, ColliderMode::MergedRectangles);
+
+        REQUIRE(
+            Box2D::getStats(merged).bodyCount
+            <= Box2D::getStats(rowRuns).bodyCount);
+
+        auto&& isSolidAt = [](const PhysicsWorld& world, const b2Vec2& point)
+        {
+            for (auto body = world->GetBodyList(); body;
+                 body = body->GetNext())
+            {
+                for (auto fixture = body->GetFixtureList(); fixture;
+                     fixture = fixture->GetNext())
+                {
+                    if (!fixture->IsSensor() && fixture->TestPoint(point))
+                        return true;
+                }
+            }
+            return false;
+        };
+
+        for (unsigned y = 0; y < level.height; ++y)
+        {
+            for (unsigned x = 0; x < level.width; ++x)
+            {
+                const auto center = b2Vec2(
+                    static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                REQUIRE(
+                    isSolidAt(rowRuns, center) == isSolidAt(merged, center));
+            }
+        }
+    }
+
+    SECTION("Outline merges blocks and slopes into a single loop")
+    {
+        // clang-format off
+        const auto level = createLevel(4, 2, {
+            E, S, B, B,
+            S, B, B, B,
+        });
+        // clang-format on
+
+        const auto outlines = SceneBuilder::getSolidOutlines(level);
+        REQUIRE(outlines.size() == 1u);
+        // Both slopes lie on the same line, so their vertices merge too
+        REQUIRE(outlines[0].size() == 4u);
+    }
+
+    SECTION("Outline keeps regions touching by a corner apart")
+    {
+        // clang-format off
+        const auto level = createLevel(2, 2, {
+            B, E,
+            E, B,
+        });
+        // clang-format on
+
+        const auto outlines = SceneBuilder::getSolidOutlines(level);
+        REQUIRE(outlines.size() == 2u);
+        REQUIRE(outlines[0].size() == 4u);
+        REQUIRE(outlines[1].size() == 4u);
+    }
+
+    SECTION("Outline of a ring has an inner loop")
+    {
+        // clang-format off
+        const auto level = createLevel(3, 3, {
+            B, B, B,
+            B, E, B,
+            B, B, B,
+        });
+        // clang-format on
+
+        REQUIRE(SceneBuilder::getSolidOutlines(level).size() == 2u);
+    }
+
+    SECTION("Chain outline creates a single static body")
+    {
+        const auto level = SceneBuilder::convertToTiledLevel(
+            TiledLoader::loadLevel(ASSETS_PATH / "levels" / "001.json"));
+
+        auto&& world = Box2D::createWorld();
+        SceneBuilder::generateColliders(
+            world, level, ColliderMode::ChainOutline);
+
+        unsigned solidBodyCount = 0;
+        for (auto body = world->GetBodyList(); body; body = body->GetNext())
+        {
+            if (!body->GetFixtureList()->IsSensor()) ++solidBodyCount;
+        }
+
+        REQUIRE(solidBodyCount == 1u);
+    }
+
+    SECTION("Prepared level builds the same scene repeatedly")
+    {
+        const auto prepared =
+            SceneBuilder::prepareLevel(SceneBuilder::convertToTiledLevel(
+                TiledLoader::loadLevel(ASSETS_PATH / "levels" / "001.json")));
+
+        const auto first = SceneBuilder::buildScene(prepared);
+        const auto second = SceneBuilder::buildScene(prepared);
+
+        REQUIRE(first.world->GetBodyCount() == second.world->GetBodyCount());
+        REQUIRE(first.magnets.size() == prepared.magnets.size());
+        REQUIRE(first.joe.GetPosition().x == second.joe.GetPosition().x);
+        REQUIRE(first.joe.GetPosition().y == second.joe.GetPosition().y);
+    }
+}
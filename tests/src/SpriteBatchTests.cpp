@@ -0,0 +1,43 @@
+#include <catch_amalgamated.hpp>
+#include <game/SpriteBatch.hpp>
+
+TEST_CASE("[SpriteBatch]")
+{
+    const auto texture = sf::Texture();
+    auto&& batch = SpriteBatch(texture);
+    auto&& sprite = sf::Sprite(texture, sf::IntRect({ 16, 8 }, { 4, 2 }));
+
+    SECTION("Adds two triangles per sprite")
+    {
+        batch.add(sprite);
+        batch.add(sprite);
+        REQUIRE(batch.getVertexCount() == 12u);
+
+        batch.clear();
+        REQUIRE(batch.getVertexCount() == 0u);
+    }
+
+    SECTION("Applies transform of the sprite")
+    {
+        sprite.setOrigin({ 2.f, 1.f });
+        sprite.setPosition({ 100.f, 50.f });
+        sprite.setScale({ 2.f, 2.f });
+        batch.add(sprite);
+
+        REQUIRE(batch[0].position == sf::Vector2f(96.f, 48.f));
+        REQUIRE(batch[0].texCoords == sf::Vector2f(16.f, 8.f));
+        REQUIRE(batch[5].position == sf::Vector2f(104.f, 52.f));
+        REQUIRE(batch[5].texCoords == sf::Vector2f(20.f, 10.f));
+    }
+
+    SECTION("Flips sprites with negative texture rect")
+    {
+        sprite.setTextureRect(sf::IntRect({ 20, 8 }, { -4, 2 }));
+        batch.add(sprite);
+
+        REQUIRE(batch[0].position == sf::Vector2f(0.f, 0.f));
+        REQUIRE(batch[0].texCoords == sf::Vector2f(20.f, 8.f));
+        REQUIRE(batch[1].position == sf::Vector2f(4.f, 0.f));
+        REQUIRE(batch[1].texCoords == sf::Vector2f(16.f, 8.f));
+    }
+}
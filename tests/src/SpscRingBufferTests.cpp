@@ -0,0 +1,67 @@
+#include <catch_amalgamated.hpp>
+#include <game/events/SpscRingBuffer.hpp>
+#include <thread>
+
+TEST_CASE("[SpscRingBuffer]")
+{
+    auto&& buffer = SpscRingBuffer<int, 4>();
+
+    SECTION("Pops items in the order they were pushed")
+    {
+        REQUIRE(buffer.tryPush(1));
+        REQUIRE(buffer.tryPush(2));
+        REQUIRE(buffer.tryPop() == 1);
+        REQUIRE(buffer.tryPush(3));
+        REQUIRE(buffer.tryPop() == 2);
+        REQUIRE(buffer.tryPop() == 3);
+        REQUIRE(buffer.isEmpty());
+        REQUIRE_FALSE(buffer.tryPop().has_value());
+    }
+
+    SECTION("Rejects items when full")
+    {
+        for (int i = 0; i < 4; ++i)
+            REQUIRE(buffer.tryPush(i));
+        REQUIRE_FALSE(buffer.tryPush(4));
+
+        REQUIRE(buffer.tryPop() == 0);
+        REQUIRE(buffer.tryPush(4));
+    }
+
+    SECTION("Drain consumes every available item")
+    {
+        REQUIRE(buffer.tryPush(1));
+        REQUIRE(buffer.tryPush(2));
+
+        int sum = 0;
+        REQUIRE(buffer.drain([&](int item) { sum += item; }) == 2u);
+        REQUIRE(sum == 3);
+        REQUIRE(buffer.drain([](int) {}) == 0u);
+    }
+
+    SECTION("Transfers items between threads without losing any")
+    {
+        const int ITEM_COUNT = 100000;
+        auto&& producer = std::jthread(
+            [&]
+            {
+                for (int i = 0; i < ITEM_COUNT; ++i)
+                {
+                    while (!buffer.tryPush(i))
+                        std::this_thread::yield();
+                }
+            });
+
+        int expected = 0;
+        bool inOrder = true;
+        while (expected < ITEM_COUNT)
+        {
+            if (auto&& item = buffer.tryPop())
+                inOrder = inOrder && *item == expected++;
+            else
+                std::this_thread::yield();
+        }
+
+        REQUIRE(inOrder);
+    }
+}
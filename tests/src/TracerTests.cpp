@@ -0,0 +1,51 @@
+#include <catch_amalgamated.hpp>
+#include <misc/JobSystem.hpp>
+#include <misc/Tracer.hpp>
+#include <nlohmann/json.hpp>
+
+TEST_CASE("[Tracer]")
+{
+    Tracer::clear();
+
+    SECTION("Records scopes and measured calls")
+    {
+        {
+            auto&& trace = TraceScope("outer", "startup");
+            REQUIRE(Tracer::measure("inner", "startup", [] { return 42; })
+                    == 42);
+        }
+
+        const auto events = Tracer::getEvents();
+        REQUIRE(events.size() == 2u);
+        REQUIRE(events[0].name == "inner");
+        REQUIRE(events[1].name == "outer");
+        REQUIRE(events[1].startUs >= 0);
+        REQUIRE(events[1].startUs <= events[0].startUs);
+        REQUIRE(events[1].durationUs >= events[0].durationUs);
+    }
+
+    SECTION("Distinguishes threads")
+    {
+        Tracer::measure("main", "startup", [] {});
+        {
+            auto&& jobs = JobSystem(1);
+            jobs.submit([] { Tracer::measure("worker", "startup", [] {}); })
+                .get();
+        }
+
+        const auto events = Tracer::getEvents();
+        REQUIRE(events.size() == 2u);
+        REQUIRE(events[0].threadIdx != events[1].threadIdx);
+    }
+
+    SECTION("Exports complete events in Chrome trace format")
+    {
+        Tracer::measure("fonts", "resources", [] {});
+
+        const auto json = nlohmann::json::parse(Tracer::exportChromeTrace());
+        REQUIRE(json["traceEvents"].size() == 1u);
+        REQUIRE(json["traceEvents"][0]["name"] == "fonts");
+        REQUIRE(json["traceEvents"][0]["cat"] == "resources");
+        REQUIRE(json["traceEvents"][0]["ph"] == "X");
+    }
+}
@@ -3,6 +3,23 @@
 
 TEST_CASE("[Utility]")
 {
+    SECTION("formatTime")
+    {
+        REQUIRE(Utility::formatTime(75.25f) == "01:15.25");
+
+        SECTION("Writes into given buffer")
+        {
+            auto&& buffer = std::array<char, 16>();
+            REQUIRE(Utility::formatTime(75.25f, buffer) == "01:15.25");
+        }
+
+        SECTION("Cuts off the result to fit the buffer")
+        {
+            auto&& buffer = std::array<char, 4>();
+            REQUIRE(Utility::formatTime(75.25f, buffer) == "01:1");
+        }
+    }
+
     SECTION("setBestTime: Returns true")
     {
         SaveState save;
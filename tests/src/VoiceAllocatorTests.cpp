@@ -0,0 +1,45 @@
+#include <array>
+#include <catch_amalgamated.hpp>
+#include <game/engine/VoiceAllocator.hpp>
+
+TEST_CASE("[VoiceAllocator]")
+{
+    auto&& allocator = VoiceAllocator(3);
+    auto&& playing = std::array { false, false, false };
+    auto&& isPlaying = [&](std::size_t idx) { return playing[idx]; };
+    auto&& acquire = [&](SoundPriority priority)
+    {
+        const auto idx = allocator.acquire(priority, isPlaying);
+        if (idx) playing[*idx] = true;
+        return idx;
+    };
+
+    SECTION("Uses idle voices first")
+    {
+        REQUIRE(acquire(SoundPriority::Buzz) == 0u);
+        REQUIRE(acquire(SoundPriority::Buzz) == 1u);
+
+        playing[0] = false;
+        REQUIRE(acquire(SoundPriority::Fanfare) == 0u);
+        REQUIRE(acquire(SoundPriority::Buzz) == 2u);
+    }
+
+    SECTION("Steals the oldest voice with the lowest priority")
+    {
+        REQUIRE(acquire(SoundPriority::Fanfare) == 0u);
+        REQUIRE(acquire(SoundPriority::Buzz) == 1u);
+        REQUIRE(acquire(SoundPriority::Buzz) == 2u);
+
+        REQUIRE(acquire(SoundPriority::Fanfare) == 1u);
+        REQUIRE(acquire(SoundPriority::Fanfare) == 2u);
+        REQUIRE(acquire(SoundPriority::Fanfare) == 0u);
+    }
+
+    SECTION("Never steals a voice with higher priority")
+    {
+        for (unsigned i = 0; i < 3; ++i)
+            REQUIRE(acquire(SoundPriority::Fanfare).has_value());
+
+        REQUIRE_FALSE(acquire(SoundPriority::Buzz).has_value());
+    }
+}